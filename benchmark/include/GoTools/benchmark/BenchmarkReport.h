@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BENCHMARKREPORT_H
+#define _BENCHMARKREPORT_H
+
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+
+namespace Go
+{
+
+    /// Peak resident set size of the current process, measured in
+    /// kilobytes. On Linux this is the high-water mark since the last
+    /// successful resetPeakResidentSetSize(), elsewhere it is the peak
+    /// over the lifetime of the process. Returns -1 if the platform
+    /// does not report it.
+    long peakResidentSetSize();
+
+    /// Reset the high-water mark reported by peakResidentSetSize() to
+    /// the current resident set size. Only supported on Linux (through
+    /// /proc/self/clear_refs). Returns false if the peak could not be
+    /// reset, in which case later readings are cumulative for the process.
+    bool resetPeakResidentSetSize();
+
+    /// The outcome of running one benchmark case.
+    struct BenchmarkResult
+    {
+	std::string name;     // Identifier of the case, e.g. "surface_point_eval"
+	std::string module;   // GoTools module exercised by the case
+	int repetitions;      // Number of timed runs
+	long operations;      // Number of operations performed in one run
+	double min_time;      // Fastest run, seconds
+	double mean_time;     // Average over all runs, seconds
+	long peak_rss_kb;     // Peak RSS, kilobytes, see peak_rss_per_case
+	bool peak_rss_per_case; // True if peak_rss_kb is the peak during this
+	                        // case, false if it is the cumulative
+	                        // process peak
+
+	/// Operations per second computed from the fastest run.
+	double throughput() const
+	{
+	    return (min_time > 0.0) ? (double)operations/min_time : 0.0;
+	}
+    };
+
+    /// Collection of benchmark results which can be written in a
+    /// machine readable form (JSON or CSV) for regression tracking.
+    class BenchmarkReport
+    {
+    public:
+	/// Constructor.
+	/// \param label free text identifying the run, e.g. a release tag
+	BenchmarkReport(const std::string& label = std::string())
+	    : label_(label)
+	{
+	}
+
+	/// Add the result of a case
+	void addResult(const BenchmarkResult& result)
+	{
+	    results_.push_back(result);
+	}
+
+	/// Access the registered results
+	const std::vector<BenchmarkResult>& results() const
+	{
+	    return results_;
+	}
+
+	/// Write the results as a JSON document
+	void writeJSON(std::ostream& os) const;
+
+	/// Write the results as CSV with one header line
+	void writeCSV(std::ostream& os) const;
+
+    private:
+	std::string label_;
+	std::vector<BenchmarkResult> results_;
+    };
+
+} // namespace Go
+
+#endif // _BENCHMARKREPORT_H
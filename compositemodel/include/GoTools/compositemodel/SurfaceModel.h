@@ -65,6 +65,7 @@ namespace Go
 
   class CurveOnSurface;
   class BoundedSurface;
+  class GenericTriMesh;
  class ftPointSet;
  class IntResultsSfModel;
  class Loop;
@@ -634,6 +635,31 @@ class GO_API SurfaceModel : public CompositeModel
 		 double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
 
+  /// Tesselate all surfaces into one triangle mesh. The resolution of
+  /// each surface is set as in tesselate(int, ...). Vertex and triangle
+  /// indices follow the order of the faces, also when the faces are
+  /// tesselated in parallel.
+  /// \param uv_res Tesselation resolution
+  /// \retval mesh Merged mesh. Triangle indices refer to the merged vertices
+  /// \retval vertex_start The vertices of face ki are numbered from
+  /// vertex_start[ki] up to vertex_start[ki+1]. Faces that could not be
+  /// tesselated have no vertices
+  /// \retval triangle_start The corresponding numbering of triangles
+  void tesselateMerged(int uv_res, GenericTriMesh& mesh,
+		       std::vector<int>& vertex_start,
+		       std::vector<int>& triangle_start) const;
+
+  /// Tesselate specified surfaces into one triangle mesh
+  /// \param faces Specified surfaces
+  /// \param uv_res Tesselation resolution
+  /// \retval mesh Merged mesh
+  /// \retval vertex_start Start of the vertices of each face in mesh
+  /// \retval triangle_start Start of the triangles of each face in mesh
+  void tesselateMerged(const std::vector<shared_ptr<ftFaceBase> >& faces,
+		       int uv_res, GenericTriMesh& mesh,
+		       std::vector<int>& vertex_start,
+		       std::vector<int>& triangle_start) const;
+
   /// Return a tesselation of the control polygon of all surfaces
   /// \retval ctr_pol Tesselation of the control polygon of all surfaces.
   virtual 
@@ -79,6 +79,20 @@ public:
     /// \param nn the number of unknowns in the system.
     void attachMatrix(double *gmat, int nn);
 
+    /// Attach the left side of the equation system given as a sparse
+    /// matrix in compressed row format. Entries equal to zero are
+    /// omitted, thus the result is the same as when attaching the
+    /// corresponding full matrix. No test is applied on whether the
+    /// matrix really is symmetric and positive definite.
+    /// \param nn the number of unknowns in the system.
+    /// \param irow index in jcol and gmat of the first entry in each
+    ///             row. Size is nn+1.
+    /// \param jcol column index of each entry. The indices must be
+    ///             increasing within each row.
+    /// \param gmat the matrix entries.
+    void attachSparseMatrix(int nn, const int *irow, const int *jcol,
+			    const double *gmat);
+
     /// Prepare for preconditioning.
     /// \param relaxfac relaxation parameter. Range: [0,0, 1.0].
     virtual void precondRILU(double relaxfac);
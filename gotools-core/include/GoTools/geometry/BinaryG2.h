@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BINARYG2_H
+#define _BINARYG2_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <deque>
+#include "GoTools/geometry/GeomObject.h"
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+/** Writes the raw data blocks of one object in a binary g2 file.
+ *  All values are stored little-endian, and every block is padded to
+ *  a multiple of 8 bytes so that arrays of doubles in a mapped file
+ *  are properly aligned.
+ */
+class BinaryG2Writer
+{
+public:
+    /// Constructor.  The stream must be opened in binary mode.
+    explicit BinaryG2Writer(std::ostream& os);
+
+    /// Write a single integer.
+    void writeInt(int value);
+
+    /// Write a block of n integers.
+    void writeInts(const int* values, size_t n);
+
+    /// Write a single double.
+    void writeDouble(double value);
+
+    /// Write a block of n doubles.
+    void writeDoubles(const double* values, size_t n);
+
+    /// Write n raw bytes.
+    void writeBytes(const char* bytes, size_t n);
+
+    /// Number of bytes written so far.
+    size_t bytesWritten() const { return written_; }
+
+private:
+    std::ostream& os_;
+    size_t written_;
+
+    void pad();
+};
+
+/** Reads the raw data blocks of one object in a binary g2 file, as
+ *  written by \ref BinaryG2Writer.  On little-endian hosts the returned
+ *  pointers point directly into the file content, otherwise into byte
+ *  swapped copies owned by the reader.  Reading past the end of the
+ *  object throws.
+ */
+class BinaryG2Reader
+{
+public:
+    /// Constructor.
+    /// \param begin first byte of the object data
+    /// \param end one past the last byte of the object data
+    BinaryG2Reader(const char* begin, const char* end);
+
+    /// Read a single integer.
+    int readInt();
+
+    /// Read a block of n integers.
+    const int* readInts(size_t n);
+
+    /// Read a single double.
+    double readDouble();
+
+    /// Read a block of n doubles.
+    const double* readDoubles(size_t n);
+
+    /// Read n raw bytes.
+    const char* readBytes(size_t n);
+
+private:
+    const char* pos_;
+    const char* end_;
+    std::deque<std::vector<char> > swapped_;
+
+    const char* block(size_t n, size_t elem_size);
+};
+
+/** Converts objects of one class to and from the binary g2 format.
+ *  Codecs are registered for a ClassType with
+ *  \ref BinaryG2::registerCodec().
+ */
+class BinaryG2Codec
+{
+public:
+    virtual ~BinaryG2Codec() {}
+
+    /// Write the object data.  The object is of the class type the
+    /// codec was registered for.
+    virtual void write(const GeomObject& obj, BinaryG2Writer& writer) const = 0;
+
+    /// Create a new object from the data.  The caller assumes ownership.
+    virtual GeomObject* read(BinaryG2Reader& reader) const = 0;
+};
+
+/** A binary, memory mappable alternative to the ASCII g2 format.
+ *
+ *  A file starts with a 32 byte header: the magic string "GoBinG2",
+ *  the format version, the number of objects and the offset of the
+ *  object table, which is placed after the object data.  Each entry
+ *  in the table holds the ClassType and the major and minor version
+ *  of the ObjectHeader, the offset and the size of the object data,
+ *  and how the data is encoded.  SplineCurve and SplineSurface are
+ *  stored as raw knot and coefficient blocks.  Other classes use a
+ *  codec registered with \ref registerCodec() if there is one, and
+ *  are otherwise stored as their ASCII g2 representation and read
+ *  back through the Factory.
+ */
+namespace BinaryG2
+{
+    /// The version of the format written by this code.
+    const int FORMAT_VERSION = 1;
+
+    /// Register a codec for objects of the given class type, replacing
+    /// any previous codec for this type.
+    void registerCodec(ClassType class_type,
+		       shared_ptr<BinaryG2Codec> codec);
+
+    /// Write objects to a stream opened in binary mode.
+    void write(std::ostream& os,
+	       const std::vector<shared_ptr<GeomObject> >& objects);
+
+    /// Write objects to a file.
+    void write(const std::string& filename,
+	       const std::vector<shared_ptr<GeomObject> >& objects);
+
+    /// Read all objects from a binary g2 file.  The file is memory
+    /// mapped, and coefficients and knots are copied directly into
+    /// the new objects.
+    std::vector<shared_ptr<GeomObject> > read(const std::string& filename);
+
+    /// Read all objects from binary g2 data held in memory.
+    /// The data should be aligned to 8 bytes.
+    std::vector<shared_ptr<GeomObject> > read(const char* data, size_t size);
+
+    /// Check if a file starts with the binary g2 magic string.
+    bool isBinaryG2(const std::string& filename);
+
+} // namespace BinaryG2
+
+} // namespace Go
+
+#endif // _BINARYG2_H
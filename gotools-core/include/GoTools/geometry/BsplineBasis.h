@@ -146,6 +146,15 @@ public:
     /// \param t the parameter value to test.
     int knotInterval(double t) const;
 
+    /// Find the interval in which the parameter value 't' lies, using
+    /// and updating an external interval hint instead of the hint stored
+    /// in the basis. This version does not modify the basis and may be
+    /// called concurrently from several threads, each with its own hint.
+    /// \param t the parameter value to test.
+    /// \param hint start guess for the search, on return the found interval.
+    ///             A negative value means no guess.
+    int knotInterval(double t, int& hint) const;
+
     /// Create a vector containing the basis values in a given parameter.
     /// \param t the parameter at which to evaluate the basis functions
     /// \param derivs the number of function derivatives to calculate for each nonzero
@@ -173,6 +182,16 @@ public:
 			    int derivs = 0,
 			    double resolution=1.0e-12) const; 
 
+    /// Similar to computeBasisValues(double, double*, int, double), but the
+    /// knot interval is located using and returned in 'hint' rather than 
+    /// in the internal state of the basis, see knotInterval(double, int&).
+    /// Thread safe as long as each thread uses its own hint.
+    void computeBasisValues(double t,
+			    double* basisvals_start,
+			    int derivs,
+			    double resolution,
+			    int& hint) const; 
+
     /// Compute basis values for many points simultaneously.
     /// \param parvals_start pointer to the start of list of parameters where you 
     ///                      want to evaluate the basis functions
@@ -221,6 +240,14 @@ public:
 				int derivs,
 				double resolution=1.0e-12) const;
 
+    /// Left evaluation using an external knot interval hint, see
+    /// computeBasisValues(double, double*, int, double, int&).
+    void computeBasisValuesLeft(double tval, 
+				double* basisvals_start,
+				int derivs,
+				double resolution,
+				int& hint) const;
+
     /// This function is similar to computeBasisValues(const double*, const double*, 
     /// double*, int*, int), except that the values are calculated from the left, as opposed
     /// to the default right-evaluation.
@@ -254,6 +281,10 @@ public:
     ///            that may be the primary wanted effect of this function.
     int knotIntervalFuzzy(double& t, double tol = DEFAULT_PARAMETER_EPSILON) const;
 
+    /// Similar to knotIntervalFuzzy(double&, double), using an external
+    /// knot interval hint, see knotInterval(double, int&).
+    int knotIntervalFuzzy(double& t, double tol, int& hint) const;
+
     /// Insert several knots into the knotvector
     /// \param new_knots a STL vector containing the new knots to insert into the vector
     void insertKnot(const std::vector<double>& new_knots);
@@ -324,6 +355,11 @@ public:
     /// \param first_coef on function completion, will point to start of relevant range
     /// \param last_coef on function completion, will point to end of relevant range
     void coefsAffectingParam(double tpar, int& first_coef, int& last_coef) const;
+
+    /// Similar to coefsAffectingParam(double, int&, int&), using an external
+    /// knot interval hint, see knotInterval(double, int&).
+    void coefsAffectingParam(double tpar, int& first_coef, int& last_coef,
+			     int& hint) const;
     
     /// Query the number of basis functions
     /// \return the number of basis functions
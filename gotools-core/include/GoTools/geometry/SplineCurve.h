@@ -44,6 +44,7 @@
 #include "GoTools/utils/DirectionCone.h"
 #include "GoTools/geometry/ParamCurve.h"
 #include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 #include "GoTools/utils/config.h"
 
 namespace Go
@@ -199,6 +200,19 @@ public:
 		       int derivs,
 		       bool from_right = true) const;
 
+    /// Reentrant version of point(Point&, double). All evaluation state is
+    /// kept in 'ctx', so the curve may be evaluated concurrently from several
+    /// threads, each with its own context.
+    void point(Point& pt, double tpar, SplineEvalContext& ctx) const;
+
+    /// Reentrant version of point(std::vector<Point>&, double, int, bool),
+    /// see point(Point&, double, SplineEvalContext&).
+    void point(std::vector<Point>& pts, 
+	       double tpar,
+	       int derivs,
+	       SplineEvalContext& ctx,
+	       bool from_right = true) const;
+
     // Inherited from ParamCurve
     virtual double startparam() const;
 
@@ -265,6 +279,17 @@ public:
 			      double&        clo_dist,
 			      double const   *seed = 0) const;
 
+    /// Reentrant version of closestPoint(), see
+    /// point(Point&, double, SplineEvalContext&).
+    void closestPoint(const Point& pt,
+		      double         tmin,
+		      double         tmax,
+		      double&        clo_t,
+		      Point&         clo_pt,
+		      double&        clo_dist,
+		      SplineEvalContext& ctx,
+		      double const   *seed = 0) const;
+
     /// Inherited from ParamCurve
     /// Compute the total length of this curve
     virtual double length(double tol);
@@ -319,6 +344,13 @@ public:
 		      std::vector<double>& basisValues,
 		      std::vector<double>& basisDerivs) const;
 
+    /// Reentrant version of computeBasis(double, std::vector<double>&,
+    /// std::vector<double>&), see point(Point&, double, SplineEvalContext&).
+    void computeBasis(double param, 
+		      std::vector<double>& basisValues,
+		      std::vector<double>& basisDerivs,
+		      SplineEvalContext& ctx) const;
+
     /// Evaluation in a number of points
     /// Does not gain effectivity compared to evaluating the points one at the
     /// time, but provides a unified interface
@@ -611,6 +643,18 @@ private:
     /// go away later.
     void appendSelfPeriodic();
 
+    // Evaluation from precomputed basis values. Shared by the ordinary
+    // and the reentrant point evaluators.
+    void pointFromBasis(Point& result, const double* basisvals,
+			int left, double* temp) const;
+    void pointFromBasis(std::vector<Point>& result, int derivs,
+			const double* basisvals, int left) const;
+
+    // Basis functions and derivatives from precomputed B-spline values
+    void basisFromBasisValues(const double* basisvals, int left,
+			      std::vector<double>& basisValues,
+			      std::vector<double>& basisDerivs) const;
+
  };
 
 
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPLINEEVALCONTEXT_H
+#define _SPLINEEVALCONTEXT_H
+
+#include <vector>
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+/// Per-thread state used when evaluating spline objects through their
+/// reentrant evaluation interface.
+/// The ordinary evaluators of SplineCurve, SplineSurface and SplineVolume
+/// store the last used knot interval inside the BsplineBasis and may use
+/// static scratch storage. Concurrent const evaluation of one shared object
+/// is therefore a data race. The evaluators taking a SplineEvalContext
+/// keep all such state in the context instead, so one read-only object can
+/// be evaluated from several threads as long as each thread owns its own
+/// context. The scratch buffers are reused between calls to avoid
+/// reallocation.
+class GO_API SplineEvalContext
+{
+public:
+    /// Constructor. No knot interval hints are set.
+    SplineEvalContext()
+    {
+	reset();
+    }
+
+    /// Forget the knot interval hints. Should be called if the context is
+    /// moved to another spline object, but it is always safe not to.
+    void reset()
+    {
+	knot_hint_[0] = knot_hint_[1] = knot_hint_[2] = -1;
+    }
+
+    /// The knot interval hint in parameter direction 'pardir' (0, 1 or 2).
+    /// The hint is used as start guess for the knot interval search and
+    /// holds the found interval after an evaluation.
+    int& knotHint(int pardir)
+    {
+	return knot_hint_[pardir];
+    }
+
+    /// Scratch buffer for basis values in parameter direction 'pardir',
+    /// resized to hold at least 'size' elements.
+    double* basisBuffer(int pardir, int size)
+    {
+	return buffer(basis_[pardir], size);
+    }
+
+    /// General purpose scratch buffer number 'idx' (0, 1 or 2), resized
+    /// to hold at least 'size' elements.
+    double* tmpBuffer(int idx, int size)
+    {
+	return buffer(tmp_[idx], size);
+    }
+
+private:
+    int knot_hint_[3];
+    std::vector<double> basis_[3];
+    std::vector<double> tmp_[3];
+
+    static double* buffer(std::vector<double>& buf, int size)
+    {
+	if ((int)buf.size() < size)
+	    buf.resize(size);
+	return buf.empty() ? 0 : &buf[0];
+    }
+};
+
+} // namespace Go
+
+#endif // _SPLINEEVALCONTEXT_H
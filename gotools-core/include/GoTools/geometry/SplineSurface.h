@@ -43,6 +43,7 @@
 
 #include "GoTools/geometry/ParamSurface.h"
 #include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 #include "GoTools/geometry/RectDomain.h"
 #include "GoTools/utils/ScratchVect.h"
 #include "GoTools/utils/config.h"
@@ -401,6 +402,22 @@ class GO_API SplineSurface : public ParamSurface
 		       bool v_from_right = true,
 		       double resolution = 1.0e-12) const;
 
+    /// Reentrant version of point(Point&, double, double). All evaluation
+    /// state is kept in 'ctx', so the surface may be evaluated concurrently
+    /// from several threads, each with its own context.
+    void point(Point& pt, double upar, double vpar,
+	       SplineEvalContext& ctx) const;
+
+    /// Reentrant version of point(std::vector<Point>&, double, double, int,
+    /// bool, bool, double), see point(Point&, double, double, SplineEvalContext&).
+    void point(std::vector<Point>& pts, 
+	       double upar, double vpar,
+	       int derivs,
+	       SplineEvalContext& ctx,
+	       bool u_from_right = true,
+	       bool v_from_right = true,
+	       double resolution = 1.0e-12) const;
+
     /// Get the start value for the u-parameter
     /// \return the start value for the u-parameter
     virtual double startparam_u() const;
@@ -438,6 +455,11 @@ class GO_API SplineSurface : public ParamSurface
      // inherited from ParamSurface
     virtual void normal(Point& n, double upar, double vpar) const;
 
+    /// Reentrant version of normal(Point&, double, double), see
+    /// point(Point&, double, double, SplineEvalContext&).
+    void normal(Point& n, double upar, double vpar,
+		SplineEvalContext& ctx) const;
+
     /// Enumerates the method for computing the normal cone
     enum NormalConeMethod { 
 	SederbergMeyers = 0,
@@ -523,6 +545,18 @@ class GO_API SplineSurface : public ParamSurface
 			      const RectDomain* domain_of_interest = NULL,
 			      double   *seed = 0) const;
 
+    /// Reentrant version of closestPoint(), see
+    /// point(Point&, double, double, SplineEvalContext&).
+    void closestPoint(const Point& pt,
+		      double&        clo_u,
+		      double&        clo_v, 
+		      Point&         clo_pt,
+		      double&        clo_dist,
+		      double         epsilon,
+		      SplineEvalContext& ctx,
+		      const RectDomain* domain_of_interest = NULL,
+		      double   *seed = 0) const;
+
     // inherited from ParamSurface
     virtual void closestBoundaryPoint(const Point& pt,
 				      double&        clo_u,
@@ -1114,6 +1148,44 @@ class GO_API SplineSurface : public ParamSurface
 		       std::vector<double>& derivs_v,
 		       bool evaluate_from_right = true) const;
 
+    /// Evaluate points, and optionally first derivatives and normals, in a
+    /// batch of scattered parameter pairs. The parameter pairs are processed
+    /// in blocks, computing the basis values of a block together. Surfaces
+    /// in 3D of order 2 to 4 in both directions use specialized, vectorizable
+    /// evaluation loops, other surfaces fall back to a general loop.
+    /// Derivatives are evaluated from the right. The function does not
+    /// modify the surface, and may be called from several threads at once.
+    /// \param num_pts number of parameter pairs
+    /// \param param_u the first parameter of each pair, size num_pts
+    /// \param param_v the second parameter of each pair, size num_pts
+    /// \param points upon function return, the evaluated points stored
+    ///               consecutively, size num_pts*dimension()
+    /// \param derivs_u if not null, upon function return the derivatives 
+    ///                 w.r.t. u, stored as the points
+    /// \param derivs_v if not null, upon function return the derivatives 
+    ///                 w.r.t. v, stored as the points
+    /// \param normals if not null, upon function return the surface normals,
+    ///                stored as the points. Requires dimension() == 3
+    /// \param normalize tells whether the normal vectors should be normalized
+    void pointBatch(int num_pts,
+		    const double* param_u,
+		    const double* param_v,
+		    double* points,
+		    double* derivs_u = 0,
+		    double* derivs_v = 0,
+		    double* normals = 0,
+		    bool normalize = true) const;
+
+    /// Convenience version of the function above. The output vectors are
+    /// resized to fit the results.
+    void pointBatch(const std::vector<double>& param_u,
+		    const std::vector<double>& param_v,
+		    std::vector<double>& points,
+		    std::vector<double>* derivs_u = 0,
+		    std::vector<double>* derivs_v = 0,
+		    std::vector<double>* normals = 0,
+		    bool normalize = true) const;
+
     /// Evaluate positions and first derivatives of all basis values in a given parameter pair
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues 
     /// where the basis values in each parameter direction are multiplied to 
@@ -1180,6 +1252,13 @@ class GO_API SplineSurface : public ParamSurface
 		      double param_v,
 		      BasisPtsSf& result) const;
 
+    /// Reentrant version of computeBasis(double, double, BasisPtsSf&), see
+    /// point(Point&, double, double, SplineEvalContext&).
+    void computeBasis(double param_u,
+		      double param_v,
+		      BasisPtsSf& result,
+		      SplineEvalContext& ctx) const;
+
     /// Compute basis values (position and 1. derivatives) in the parameter 
     /// (param_u,param_v). Store result in a BasisDerivSf entity
     void computeBasis(double param_u,
@@ -1187,6 +1266,14 @@ class GO_API SplineSurface : public ParamSurface
 		      BasisDerivsSf& result,
 		      bool evaluate_from_right = true) const;
 
+    /// Reentrant version of computeBasis(double, double, BasisDerivsSf&, bool),
+    /// see point(Point&, double, double, SplineEvalContext&).
+    void computeBasis(double param_u,
+		      double param_v,
+		      BasisDerivsSf& result,
+		      SplineEvalContext& ctx,
+		      bool evaluate_from_right = true) const;
+
     /// Compute basis values (position and uni-directed derivatives) in the parameter
     /// (param_u,param_v). Store result in a BasisDerivsSfU entity
     void computeBasis(double param_u,
@@ -1419,12 +1506,35 @@ class GO_API SplineSurface : public ParamSurface
     // Helper functions
     void updateCoefsFromRcoefs();
     std::vector<double>& activeCoefs() { return rational_ ? rcoefs_ : coefs_; }
-    bool normal_not_failsafe(Point& n, double upar, double vpar) const;
+    bool normal_not_failsafe(Point& n, double upar, double vpar,
+			     SplineEvalContext* ctx = 0) const;
     bool search_for_normal(bool interval_in_u,
 			   double fixed_parameter,
 			   double interval_start, // normal is not defined here
 			   double interval_end,
-			   Point& normal) const;
+			   Point& normal,
+			   SplineEvalContext* ctx = 0) const;
+    void normal_impl(Point& n, double upar, double vpar,
+		     SplineEvalContext* ctx) const;
+    void closest_point_impl(const Point& pt,
+			    double& clo_u,
+			    double& clo_v, 
+			    Point& clo_pt,
+			    double& clo_dist,
+			    double epsilon,
+			    const RectDomain* domain_of_interest,
+			    double *seed,
+			    SplineEvalContext* ctx) const;
+
+    // Tensor product evaluation from precomputed basis values. Shared by
+    // the ordinary and the reentrant point evaluators.
+    void pointFromBasis(Point& result,
+			const double* basis_u, int uleft,
+			const double* basis_v, int vleft,
+			double* tmp_pt, double* tmp_result) const;
+    void pointFromBasis(std::vector<Point>& result, int derivs,
+			const double* basis_u, int uleft,
+			const double* basis_v, int vleft) const;
 
     // Members new to this class
  public:
@@ -1501,7 +1611,7 @@ class GO_API SplineSurface : public ParamSurface
 			     double start_v, double end_v) const;
 
     void s1773(const double ppoint[],double aepsge, double estart[],double eend[],double enext[],
-	       double gpos[],int *jstat) const;
+	       double gpos[],int *jstat, SplineEvalContext* ctx = 0) const;
 
     void s1773_s9corr(double gd[],double acoef1,double acoef2,
 		      double astart1,double aend1,double astart2,double aend2) const;
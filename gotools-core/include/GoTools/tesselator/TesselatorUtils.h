@@ -58,6 +58,23 @@ namespace TesselatorUtils
   /// Fetch the control polygon of some geometric entity
   shared_ptr<LineCloud> getCtrPol(GeomObject* obj);
 
+  /// Evaluate a surface in a regular grid of num_u x num_v parameter
+  /// values spanning [umin, umax] x [vmin, vmax], the u index running
+  /// fastest. Points and first derivatives are stored with three
+  /// components per grid node, padded with zeros for 2D surfaces.
+  /// If requested, unit normals are computed as for
+  /// ParamSurface::normal(). Spline surfaces are evaluated in one
+  /// batch, other surfaces point by point. For spline surfaces the
+  /// normal is the normalized cross product of the batched
+  /// derivatives, and normal() is only called where this cross
+  /// product is shorter than DEFAULT_SPACE_EPSILON.
+  void evalGrid(const ParamSurface& surf, int num_u, int num_v,
+		double umin, double umax, double vmin, double vmax,
+		std::vector<double>& points,
+		std::vector<double>* normals = 0,
+		std::vector<double>* derivs_u = 0,
+		std::vector<double>* derivs_v = 0);
+
 }  // of namespace TesselatorUtils
 }; // end namespace Go
 #endif // _TESSELATORUTILS_H
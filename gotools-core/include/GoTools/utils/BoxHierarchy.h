@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BOXHIERARCHY_H
+#define _BOXHIERARCHY_H
+
+#include "GoTools/utils/Point.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <functional>
+
+namespace Go
+{
+
+/// Bounding volume hierarchy over a set of axis aligned boxes in 3D.
+/// Used to find the boxes containing a point, and to visit the boxes
+/// nearest first when searching for a closest point. Each node is split
+/// at the median box centre along the axis where the centres have the
+/// largest extent, until a leaf holds few enough boxes.
+class GO_API BoxHierarchy
+{
+public:
+    /// Constructor. Makes an empty hierarchy
+    BoxHierarchy();
+
+    /// Destructor
+    ~BoxHierarchy();
+
+    /// Build the hierarchy. Any previous content is discarded.
+    /// \param boxes 6 values per box, (xmin, ymin, zmin, xmax, ymax, zmax).
+    ///              Box number i is referred to by the index i
+    /// \param max_leaf_size maximum number of boxes in a leaf
+    void build(std::vector<double> boxes, int max_leaf_size);
+
+    /// Number of boxes
+    int nmbBoxes() const
+    {
+	return (int)boxes_.size()/6;
+    }
+
+    /// The box with the given index, 6 values as given to build()
+    const double* box(int idx) const
+    {
+	return &boxes_[6*idx];
+    }
+
+    /// Indices of the boxes containing the point, extended by epsilon
+    void containingBoxes(const Point& pt, double epsilon,
+			 std::vector<int>& boxes) const;
+
+    /// Indices of the boxes overlapping a given box, extended by epsilon
+    /// \param box 6 values, as given to build()
+    void overlappingBoxes(const double* box, double epsilon,
+			  std::vector<int>& boxes) const;
+
+    /// Visit the boxes nearest first, until the next node of the
+    /// hierarchy is at least dist away from the point. Boxes farther
+    /// away than dist are skipped.
+    /// \param pt the point
+    /// \param dist current distance bound. The visitor may reduce it
+    /// \param visit function called with the index of each visited box
+    ///              and dist
+    void visitNearest(const Point& pt, double& dist,
+		      const std::function<void(int, double&)>& visit) const;
+
+    /// Squared distance between a point and a box, 0 inside the box
+    static double boxDist2(const double* box, const Point& pt);
+
+    /// The memory used by the boxes and the hierarchy, in bytes
+    size_t memory() const;
+
+private:
+    /// Node in the hierarchy. The box of a node is stored as the other
+    /// boxes. The children of an internal node are left_ and right_. For a leaf
+    /// node left_ is -1, and the boxes are box_idx_[first_], ...,
+    /// box_idx_[first_ + count_ - 1]
+    struct Node
+    {
+	double box_[6];
+	int left_;
+	int right_;
+	int first_;
+	int count_;
+    };
+
+    std::vector<double> boxes_;
+    std::vector<Node> nodes_;
+    std::vector<int> box_idx_;
+};
+
+} // namespace Go
+
+#endif // _BOXHIERARCHY_H
@@ -42,6 +42,8 @@
 
 
 #include <vector>
+#include <iostream>
+#include <string>
 #include "GoTools/utils/Point.h"
 #include "GoTools/geometry/GeomObject.h"
 
@@ -319,6 +321,18 @@ namespace Go
 	polygon_v_.resize(0);
       }
 
+      /// Get the u-parameters of the polygon points
+      const std::vector<double>& polygon_u() const
+      {
+	return polygon_u_;
+      }
+
+      /// Get the v-parameters of the polygon points
+      const std::vector<double>& polygon_v() const
+      {
+	return polygon_v_;
+      }
+
     private:
 
       /// The structure data of the surface
@@ -361,6 +375,24 @@ namespace Go
 
     public:
 
+      /// Constructor, making an empty structure
+      BoundingBoxStructure()
+	: voxel_length_(0.0), n_voxels_x_(0), n_voxels_y_(0), n_voxels_z_(0),
+	  big_vox_low_(0.0, 0.0, 0.0)
+      {
+      }
+
+      /// A node in the bounding volume hierarchy over the segments, the nodes are stored in a flat array.
+      /// For an internal node (count_ == 0), the children are the nodes at positions first_ and first_ + 1.
+      /// For a leaf node, the segments are bvh_box(first_), ..., bvh_box(first_ + count_ - 1)
+      struct BVHNode
+      {
+	double low_[3];
+	double high_[3];
+	int first_;
+	int count_;
+      };
+
       /// Add information of a specific parameter sub segment of a surface to the structure
       void addBox(shared_ptr<SubSurfaceBoundingBox> box)
       {
@@ -488,6 +520,76 @@ namespace Go
 	  }
       }
 
+      /// Tell if the voxel structure is created
+      bool hasVoxelStructure() const
+      {
+	return !boxes_in_voxel_.empty();
+      }
+
+      /// Creates a bounding volume hierarchy over the segment bounding boxes, using a binned surface area
+      /// heuristic for the splitting. The hierarchy is an alternative to the voxel structure in the closest
+      /// point calculations, and is less sensitive to models with very uneven segment sizes.
+      /// max_leaf_size is the largest number of segments in a leaf node
+      void BuildBVH(int max_leaf_size = 4);
+
+      /// Tell if the bounding volume hierarchy is created
+      bool hasBVH() const
+      {
+	return !bvh_nodes_.empty();
+      }
+
+      /// Get the number of nodes in the bounding volume hierarchy, the root is node 0
+      int n_bvh_nodes() const
+      {
+	return (int)bvh_nodes_.size();
+      }
+
+      /// Get a specific node in the bounding volume hierarchy
+      const BVHNode& bvh_node(int i) const
+      {
+	return bvh_nodes_[i];
+      }
+
+      /// Get the segment index at a specific position in the segment list of the hierarchy leaves
+      int bvh_box(int i) const
+      {
+	return bvh_boxes_[i];
+      }
+
+      /// Get the memory used by the voxel structure, in bytes
+      size_t voxelStructureMemory() const
+      {
+	size_t mem = boxes_in_voxel_.capacity() * sizeof(std::vector<std::vector<std::vector<int> > >);
+	for (size_t i = 0; i < boxes_in_voxel_.size(); ++i)
+	  {
+	    mem += boxes_in_voxel_[i].capacity() * sizeof(std::vector<std::vector<int> >);
+	    for (size_t j = 0; j < boxes_in_voxel_[i].size(); ++j)
+	      {
+		mem += boxes_in_voxel_[i][j].capacity() * sizeof(std::vector<int>);
+		for (size_t k = 0; k < boxes_in_voxel_[i][j].size(); ++k)
+		  mem += boxes_in_voxel_[i][j][k].capacity() * sizeof(int);
+	      }
+	  }
+	return mem;
+      }
+
+      /// Get the memory used by the bounding volume hierarchy, in bytes
+      size_t bvhMemory() const
+      {
+	return bvh_nodes_.capacity() * sizeof(BVHNode) + bvh_boxes_.capacity() * sizeof(int);
+      }
+
+      /// Write the preprocessed data of the structure to a binary stream, in native byte order.
+      /// The surfaces themselves are not written, only their number.
+      /// hash identifies the surface model and parameters used when creating the structure, see closestVectorsHash()
+      void write(std::ostream& os, unsigned long long hash) const;
+
+      /// Read the preprocessed data of the structure from a binary stream made by write(), replacing the current content.
+      /// surfaces must be the surface model used when creating the structure, and hash the value given to write().
+      /// Returns false, leaving the structure unchanged, if the stream does not hold a structure of the current
+      /// format version, if the hash values differ or if the stream is incomplete.
+      bool read(std::istream& is, const std::vector<shared_ptr<GeomObject> >& surfaces, unsigned long long hash);
+
       /// Test for closestPoint. Only used by the old code, closestVectorsOld()
       /// Will be removed if we know closestVectors() is safe
       bool closestPoint(int box_idx, bool any_tested, double best_dist, bool isInside, const Point& pt,
@@ -539,6 +641,12 @@ namespace Go
       /// The segments that hit each voxel
       std::vector<std::vector<std::vector<std::vector<int> > > > boxes_in_voxel_;
 
+      /// The nodes of the bounding volume hierarchy
+      std::vector<BVHNode> bvh_nodes_;
+
+      /// The segment indices, ordered such that each leaf node refers to a contiguous range
+      std::vector<int> bvh_boxes_;
+
     };  // End class BoundingBoxStructure
 
 
@@ -546,11 +654,32 @@ namespace Go
   } // namespace Go::boxStructuring
 
 
+  /// The search structure created by preProcessClosestVectors()
+  enum ClosestVectorsSearch
+  {
+    VOXEL_SEARCH,  ///< Voxel structure of equal sized boxes over the geometry space
+    BVH_SEARCH     ///< Bounding volume hierarchy over the segments, no voxel structure
+  };
+
   /// Create preprocessing data for the closest vector calculations on a surface.
   /// surfaces - a collection of the paramteric surfaces defining the surface model. Only instances of the ParamSurface subclass hierarchy are used
   /// par_len_el - a guiding for the side lengths of the segments in geometry space, used to determine the number of segments for elementary surfaces
+  /// search - the search structure to create. With BVH_SEARCH the voxel structure, whose memory use grows quickly for models with
+  ///          very uneven segment sizes, is not created
   /// returns the preprocessing structures used as input for the closest point calculations
-  shared_ptr<boxStructuring::BoundingBoxStructure> preProcessClosestVectors(const std::vector<shared_ptr<GeomObject> >& surfaces, double par_len_el);
+  shared_ptr<boxStructuring::BoundingBoxStructure> preProcessClosestVectors(const std::vector<shared_ptr<GeomObject> >& surfaces, double par_len_el,
+									    ClosestVectorsSearch search = VOXEL_SEARCH);
+
+  /// Same as above, but the preprocessing data are cached in a binary file. If cache_file holds a structure made from
+  /// the same surfaces and par_len_el, and with the requested search structure, the structure is read from the file.
+  /// Otherwise the structure is created and written to cache_file, replacing any previous content.
+  shared_ptr<boxStructuring::BoundingBoxStructure> preProcessClosestVectors(const std::vector<shared_ptr<GeomObject> >& surfaces, double par_len_el,
+									    const std::string& cache_file,
+									    ClosestVectorsSearch search = VOXEL_SEARCH);
+
+  /// Get a hash value identifying a surface model and the par_len_el value for preProcessClosestVectors().
+  /// Used as key when caching the preprocessing data.
+  unsigned long long closestVectorsHash(const std::vector<shared_ptr<GeomObject> >& surfaces, double par_len_el);
 
 
   void closestPointSingleCalculation(int pt_idx, int start_idx, int skip,
@@ -558,7 +687,7 @@ namespace Go
 				     const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
 				     const shared_ptr<boxStructuring::BoundingBoxStructure>& boxStructure,
 				     std::vector<float>& result, std::vector<std::vector<int> >& lastBoxCall,
-				     int return_type, int search_extend);
+				     int return_type, int search_extend, bool use_bvh = false);
 
   /// Calculates the closest points of a point cloud to a surface model, after a SO(3)-rotation and translation is applied on the point clod.
   /// The method uses polygons inside the bounding curves on paramter domains to help determining if parameter pairs are inside the
@@ -577,10 +706,22 @@ namespace Go
   /// search_extend  - Used to define the number of segments to be added in each direction when defining the parameter subset on which
   ///                  the closest point functions should be performed. Will be removed.
   /// m_core         - Whether the calculations should be performed in parallell on multiple cores (only if OPENMP is included)
+  /// use_bvh        - Whether the segments should be searched through the bounding volume hierarchy (nearest first) instead of the
+  ///                  voxel structure. The hierarchy must exist, see preProcessClosestVectors() and BuildBVH(). A structure without
+  ///                  voxel structure is always searched through the hierarchy. The structure is not modified by the search.
+  /// spatial_sort   - Whether the points should be handled in the order given by spatialSortOrder(), so that consecutive points,
+  ///                  also inside each thread, are close to each other. The results are still returned in the input order
   /// returns   A vector of the distances to the closest points for the subset on which the calculations are performed.
   std::vector<float> closestPointCalculations(const std::vector<float>& pts, const shared_ptr<boxStructuring::BoundingBoxStructure>& structure,
 					      const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
-					      int return_type, int start_idx, int skip, int max_idx, int search_extend = 3, bool m_core = true);
+					      int return_type, int start_idx, int skip, int max_idx, int search_extend = 3, bool m_core = true,
+					      bool use_bvh = false, bool spatial_sort = false);
+
+  /// Get an ordering of a point cloud along a Morton (Z-order) space filling curve over its bounding box, such that
+  /// points close in the ordering are close in space.
+  /// pts - The point cloud, of length 3N where N is the number of points, on format p[0][0], p[0][1], p[0][2], p[1][0] , ...
+  /// returns a vector of length N, where entry i is the index of the point at position i in the sorted sequence
+  std::vector<int> spatialSortOrder(const std::vector<float>& pts);
 
 
   /// Calculates the closest points of a point cloud to a surface model, by not using the inside polygons in closestVectors()
@@ -649,6 +790,31 @@ namespace Go
                                                    const shared_ptr<boxStructuring::BoundingBoxStructure>& boxStructure,
                                                    const std::vector<std::vector<double> >& rotationMatrix, const Point& translation);
 
+  /// Streaming version of closestPointCalculations(), for point clouds too large to be held in memory.
+  /// The points are read from in_stream in chunks of chunk_size points, each chunk is processed against the prebuilt
+  /// structure and its results are written to out_stream before the next chunk is read. Memory use is thus bounded by the
+  /// chunk size, regardless of the size of the point cloud.
+  /// in_stream      - Binary stream of native floats, the point cloud on format p[0][0], p[0][1], p[0][2], p[1][0], ...
+  /// out_stream     - Binary stream receiving the results as native floats, in the layout returned by closestPointCalculations()
+  ///                  for the given return_type (1, 1, 3 or 4 floats per point)
+  /// return_type    - Tell whether the distances (0), signed distances (1), closest points (2) or signed distances with
+  ///                  surface parameters (3) should be written
+  /// chunk_size     - The number of points read and processed at a time
+  /// m_core         - Whether each chunk should be processed in parallell on multiple cores (only if OPENMP is included)
+  /// returns the number of points processed
+  long long closestPointCalculationsStream(std::istream& in_stream, std::ostream& out_stream,
+					   const shared_ptr<boxStructuring::BoundingBoxStructure>& structure,
+					   const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
+					   int return_type, int chunk_size = 1048576, bool m_core = true);
+
+  /// Calculates the closest point for each point in a point cloud stored in a binary file, see closestPointCalculationsStream().
+  /// The closest points are written to out_file in the same binary format as the input points.
+  /// returns the number of points processed
+  long long closestPointsFile(const std::string& in_file, const std::string& out_file,
+			      const shared_ptr<boxStructuring::BoundingBoxStructure>& structure,
+			      const std::vector<std::vector<double> >& rotationMatrix, const Point& translation,
+			      int chunk_size = 1048576);
+
 } // namespace Go
 
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include <string>
+#include <vector>
+
+namespace Go
+{
+
+/// Read-only view of the content of a file.  The file is memory mapped
+/// where this is supported, otherwise it is read into memory.  The
+/// content stays valid for the lifetime of the MappedFile.
+class MappedFile
+{
+public:
+    /// Open and map the file.  Throws if the file can not be opened.
+    /// \param filename name of the file
+    /// \param sequential hint to the system that the file will mostly
+    ///                   be traversed from beginning to end.
+    explicit MappedFile(const std::string& filename, bool sequential = true);
+
+    /// Destructor, unmaps the file.
+    ~MappedFile();
+
+    /// Pointer to the first byte of the file (null if the file is empty).
+    const char* data() const { return data_; }
+
+    /// Size of the file in bytes.
+    size_t size() const { return size_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    void* map_;
+    std::vector<char> buffer_;
+
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+};
+
+} // namespace Go
+
+#endif // _MAPPEDFILE_H
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _THREADERRORS_H
+#define _THREADERRORS_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <exception>
+
+namespace Go
+{
+
+/// Exceptions thrown in a parallel loop. Each thread keeps its first
+/// exception and skips its remaining iterations. After the loop, the
+/// exception of the lowest iteration index is rethrown, which is the one
+/// a serial loop would have thrown if the iterations are independent.
+/// Typical use:
+/// \code
+/// ThreadErrors errors(nmb_threads);
+/// #pragma omp parallel for
+/// for (int ki = 0; ki < num; ++ki)
+///   {
+///     int thread = omp_get_thread_num();
+///     if (errors.failed(thread))
+///       continue;
+///     try { ... }
+///     catch (...) { errors.record(thread, ki); }
+///   }
+/// errors.rethrowFirst();
+/// \endcode
+class GO_API ThreadErrors
+{
+public:
+    /// Constructor
+    /// \param nmb_threads the number of threads in the loop
+    explicit ThreadErrors(int nmb_threads);
+
+    /// Whether the thread has recorded an exception
+    bool failed(int thread) const
+    {
+	return (bool)errors_[thread];
+    }
+
+    /// Record the exception being handled. Call from a catch block.
+    /// \param thread the thread number
+    /// \param idx the iteration index
+    void record(int thread, int idx);
+
+    /// Rethrow the recorded exception of the lowest iteration index.
+    /// Does nothing if no exception is recorded.
+    void rethrowFirst() const;
+
+private:
+    std::vector<int> idx_;
+    std::vector<std::exception_ptr> errors_;
+};
+
+} // namespace Go
+
+#endif // _THREADERRORS_H
@@ -234,6 +234,10 @@ public:
     void readdisp(std::istream& is);
     /// Read an IGES file
     void readIGES(std::istream& is);
+    /// Read an IGES file given by its name. The file is memory mapped
+    /// and entities that do not refer to other entities are parsed in
+    /// parallel when OpenMP is enabled.
+    void readIGES(const std::string& filename);
 
     /// Write the content of this converter to a g2-file
     void writego(std::ostream& os);
@@ -369,17 +373,29 @@ private:
     void writeIGEScolour(const std::vector<double>& colour, std::string& g,
 			 std::vector<IGESdirentry>& dirent, int& Pcurr);
 
+    // Parse the content of the sections read from an IGES file
+    void readIGESsections(std::string sbufs[5]);
+
     IGESdirentry readIGESdirentry(const char* start);
+    // Read an entity which does not refer to other entities (except
+    // transformation matrices). Safe to call concurrently.
+    shared_ptr<Go::GeomObject>
+      readIGESindependentEntity(const char* start, int direntry_index,
+				Go::Point& plane_normal);
     shared_ptr<Go::SplineSurface>
       readIGESsurface(const char* start, int num_lines);
     void writeIGESsurface(Go::SplineSurface* surf, int colour, std::string& g,
                           std::vector<IGESdirentry>& dirent, int& Pcurr,
 			  int dependency = 0);
+    // The plane normal of a planar curve is returned in plane_normal,
+    // otherwise an empty point.
     shared_ptr<Go::SplineCurve>
-      readIGEScurve(const char* start, int num_lines, int direntry_index);
+      readIGEScurve(const char* start, int num_lines, int direntry_index,
+		    Go::Point& plane_normal);
 //     shared_ptr<Go::SplineCurve>
     shared_ptr<Go::BoundedCurve>
-      readIGESline(const char* start, int num_lines, int direntry_index);
+      readIGESline(const char* start, int num_lines, int direntry_index,
+		   Go::Point& plane_normal);
     shared_ptr<Go::PointCloud3D> readIGESpointCloud(const char* start,
 						int num_lines);
     shared_ptr<Go::PointCloud3D>
@@ -117,6 +117,18 @@ void make_matrix(const PointCloud4D& cloud, int deg,
 void make_implicit_svd(std::vector<std::vector<double> >& mat, 
 		       std::vector<double>& b, double& sigma_min);
 
+/// Performs implicitization by finding the right singular vector of
+/// the smallest singular value of D. The triangular factor R of a QR
+/// factorization of D, which satisfies R^T R = D^T D, is computed by
+/// processing the rows of D in blocks, and the singular vector is
+/// found by inverse iteration with R^T R. The accuracy is comparable
+/// to make_implicit_svd(), but it is considerably faster for high
+/// implicit degrees. Only local storage is used, so the function may
+/// be called concurrently from several threads. sigma_min is computed
+/// as the norm of D times the solution.
+void make_implicit_qr(const std::vector<std::vector<double> >& mat,
+			std::vector<double>& b, double& sigma_min);
+
 /// Performs implicitization using Gaussian elimination. This method
 /// is suitable when the implicitization is exact. If the
 /// implicitization is approximate, make_implicit_svd() is better.
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _INTERSECTIONARENA_H
+#define _INTERSECTIONARENA_H
+
+
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <cstddef>
+#include <utility>
+
+
+namespace Go {
+
+
+/// Memory arena for the IntersectionPoint and IntersectionLink
+/// objects of one top level intersection. The objects are allocated
+/// from large blocks, and memory released by an object is kept on a
+/// free list for the next object of the same size. The blocks are
+/// returned in one go when the arena is destroyed, i.e. when the
+/// last object allocated from it is gone. The arena may be used by
+/// several threads. Each thread allocates from its own part of a
+/// block and keeps its own free lists, so only fetching a new block
+/// takes a lock. Memory released by a thread is reused by that
+/// thread, whichever thread allocated it.
+
+class IntersectionArena
+    : public std::enable_shared_from_this<IntersectionArena> {
+public:
+    /// Constructor
+    /// \param block_size the size in bytes of the blocks from which
+    /// the objects are allocated
+    IntersectionArena(size_t block_size = 65536);
+
+    /// Destructor. Releases all blocks.
+    ~IntersectionArena();
+
+    /// Allocate memory
+    /// \param bytes the number of bytes to allocate
+    /// \return pointer to the memory
+    void* allocate(size_t bytes);
+
+    /// Return memory to the arena
+    /// \param ptr pointer to memory obtained by allocate()
+    /// \param bytes the size given to allocate()
+    void deallocate(void* ptr, size_t bytes);
+
+    /// The number of bytes held by the arena
+    size_t memoryUsage() const;
+
+private:
+    // Allocation state of one thread. Only the owning thread touches
+    // it after it is made.
+    struct ThreadCache {
+	std::thread::id thread_;
+	char* next_;   // Next free byte in the current block
+	char* end_;    // End of the current block
+	// Free lists, indexed by size in units
+	std::vector<void*> free_;
+	// Keep the caches of different threads on different cache lines
+	char padding_[64];
+    };
+
+    // Granularity of the allocations. All sizes are rounded up to a
+    // multiple of this value, which is also the alignment. Large
+    // requests go directly to the system allocator.
+    static const size_t unit_ = 16;
+
+    size_t block_size_;
+    unsigned long long id_;   // Unique for every arena made
+
+    // Guarded by mutex_
+    std::vector<char*> blocks_;
+    std::vector<ThreadCache*> caches_;
+    mutable std::mutex mutex_;
+
+    // The cache of the calling thread
+    ThreadCache* threadCache();
+
+    // Fetch a new block for a thread cache
+    void newBlock(ThreadCache* cache);
+
+    IntersectionArena(const IntersectionArena&);
+    IntersectionArena& operator=(const IntersectionArena&);
+};
+
+
+/// Standard allocator taking its memory from an IntersectionArena.
+/// Use with std::allocate_shared, in which case the object and its
+/// reference count share one allocation, and the allocator keeps the
+/// arena alive as long as the object exists.
+
+template <class T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    /// Constructor
+    /// \param arena the arena providing the memory
+    explicit ArenaAllocator(shared_ptr<IntersectionArena> arena)
+	: arena_(std::move(arena))
+    {}
+
+    /// Conversion from an allocator of another type
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other)
+	: arena_(other.arena())
+    {}
+
+    /// Allocate memory for \a n objects
+    T* allocate(size_t n)
+    { return static_cast<T*>(arena_->allocate(n*sizeof(T))); }
+
+    /// Return memory for \a n objects
+    void deallocate(T* ptr, size_t n)
+    { arena_->deallocate(ptr, n*sizeof(T)); }
+
+    /// The arena of the allocator
+    const shared_ptr<IntersectionArena>& arena() const
+    { return arena_; }
+
+private:
+    shared_ptr<IntersectionArena> arena_;
+};
+
+template <class T, class U>
+inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{ return a.arena() == b.arena(); }
+
+template <class T, class U>
+inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{ return a.arena() != b.arena(); }
+
+
+} // namespace Go
+
+
+#endif // _INTERSECTIONARENA_H
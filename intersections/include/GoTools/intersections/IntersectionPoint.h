@@ -57,6 +57,7 @@ class ParamObjectInt;
 class ParamGeomInt;
 class ParamSurface;
 class IntersectionLink;
+class IntersectionArena;
 
 
 /// Object describing a point located on the intersection of two
@@ -109,9 +110,17 @@ public:
     ~IntersectionPoint();
 
     /// Default constructor
-    IntersectionPoint() {} // create an undefined point which can be
-			   // assigned or read() into.
+    IntersectionPoint() : arena_(0) {} // create an undefined point
+				       // which can be assigned or
+				       // read() into.
     
+    /// Let the links made from this point be allocated in an arena.
+    /// The arena must outlive the point, which is the case when the
+    /// point itself is allocated from the arena.
+    /// \param arena the arena (null pointer for the ordinary heap)
+    void setArena(IntersectionArena* arena)
+    { arena_ = arena; }
+
     /// Write IntersectionPoint to stream (NB: topological and parent
     /// information will be lost)
     /// \param os output stream
@@ -770,6 +779,9 @@ private:
     // Tolerance-related stuff
     shared_ptr<GeoTol> epsge_;
 
+    // Memory arena for new links (no ownership)
+    IntersectionArena* arena_;
+
     // Caching of influence area
     mutable std::vector<CachedInterval> cached_influence_area_forwards_;
     mutable std::vector<CachedInterval> cached_influence_area_backwards_;
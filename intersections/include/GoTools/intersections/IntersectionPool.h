@@ -44,6 +44,7 @@
 #include "GoTools/intersections/ParamObjectInt.h"
 #include "GoTools/intersections/IntersectionPoint.h"
 #include "GoTools/intersections/IntersectionCurve.h"
+#include "GoTools/intersections/IntersectionArena.h"
 #include "GoTools/utils/Point.h"
 #include <memory>
 #include <vector>
@@ -509,6 +510,36 @@ public:
     /// \return value of the missing parameter
     double lackingParameterValue() const;
 
+    /// Check if this pool and another pool refer to a common object.
+    /// \param other the other pool
+    /// \return 'true' if the pools share at least one of their
+    /// objects, 'false' otherwise.
+    bool sharesObjectWith(const IntersectionPool& other) const;
+
+    /// Get the intersection points that may be changed when the
+    /// intersections of this pool are computed, i.e. the points in
+    /// the pool and their neighbours.
+    /// \param points the points, sorted and without duplicates
+    /// \return 'false' if includeCoveredNeighbourPoints() would add
+    /// points to the pool, in which case the set is not complete.
+    bool getPointsInUse(std::vector<IntersectionPoint*>& points) const;
+
+    /// Detach the pool from its parent pool. Until
+    /// reattachParentPool() is called, the pool refers to a private
+    /// pool starting out with the points of the parent pool. Points
+    /// propagated upwards from this pool are collected in the
+    /// private pool instead of in the parent pool and its ancestors,
+    /// and points removed from this pool are only removed from the
+    /// private pool. Used when sibling pools not sharing any points
+    /// are computed concurrently.
+    void detachParentPool();
+
+    /// Reattach a pool detached by detachParentPool(). Points of the
+    /// parent pool which were removed in the meantime are removed
+    /// from the parent pool and its ancestors, and the points added
+    /// are propagated to them in the order in which they were added.
+    void reattachParentPool();
+
     /// Check if two IntersectionPoints lie on the same boundary of
     /// the parametric domain of this IntersectionPools objects
     /// (\a obj1_ and \a obj2_).
@@ -808,14 +839,38 @@ private:
     double missing_param_value_;
 
     shared_ptr<IntersectionPool> prev_pool_;
+
+    // The real parent pool while this pool is detached
+    shared_ptr<IntersectionPool> detached_pool_;
+
+    // The points of the parent pool when detached, sorted
+    std::vector<IntersectionPoint*> detached_points_;
+
+    // Memory for the points and links of this pool. Shared by all
+    // pools of one top level intersection.
+    shared_ptr<IntersectionArena> arena_;
 //     static const double REL_PAR_RES_; // a tolerance - @move this
 // 				      // somewhere else??
 
     // Functions
 
+    // Make a new intersection point in the arena of the pool
+    template <class... Args>
+    shared_ptr<IntersectionPoint> new_point(Args&&... args)
+    {
+	shared_ptr<IntersectionPoint> point
+	    = std::allocate_shared<IntersectionPoint>
+	    (ArenaAllocator<IntersectionPoint>(arena_),
+	     std::forward<Args>(args)...);
+	point->setArena(arena_.get());
+	return point;
+    }
+
     void 
     add_point_and_propagate_upwards(shared_ptr<IntersectionPoint> point);
 
+    void remove_point_upwards(shared_ptr<IntersectionPoint> point);
+
     void iterateToSplitPoint(shared_ptr<IntersectionLink> link,
 			     int fixed_dir, double fixed_value,
 			     double par[], double& dist);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _INTERSECTIONTRACE_H
+#define _INTERSECTIONTRACE_H
+
+
+#include <vector>
+#include <ostream>
+#include <cstddef>
+
+
+namespace Go {
+
+
+/// The cases recorded by the intersection tracing
+enum IntersectionTraceEvent {
+    TRACE_COMPUTE = 0,     ///< Intersector::compute, one recursion level
+    TRACE_BOUNDARY,        ///< Intersections at the boundaries
+    TRACE_INTERCEPTION,    ///< Interception test
+    TRACE_MICRO_CASE,      ///< Objects too small for further processing
+    TRACE_DEG_TRIANGLE,    ///< Degenerate triangular surfaces test
+    TRACE_COINCIDENCE,     ///< Coincidence test
+    TRACE_SIMPLE_CASE,     ///< Simple case test
+    TRACE_UPDATE,          ///< Computation of a simple or linear case
+    TRACE_LINEAR_CASE,     ///< Linear case test
+    TRACE_COMPLEX_INTERCEPT, ///< Interception test by implicitization
+    TRACE_COMPLEX_SIMPLE,  ///< Simple case test by implicitization
+    TRACE_COMPLEXITY,      ///< Complexity test, and handling when not reduced
+    TRACE_SUBDIVISION,     ///< Subdivision of the objects
+    TRACE_POST_ITERATE,    ///< Post iteration of intersection points
+    TRACE_FINISH,          ///< Clean up, repair and curve generation
+    TRACE_NMB_EVENTS
+};
+
+
+/// Tracing of the intersection recursion. Every thread records the
+/// cases met in the recursion, with recursion depth and time, in a
+/// ring buffer of its own. When the buffer is full, the oldest events
+/// are overwritten, while the counters keep counting.
+///
+/// The recording in the intersectors is compiled in only if
+/// GOTOOLS_INTERSECTION_TRACE is defined (CMake option
+/// GoTools_ENABLE_INTERSECTION_TRACE). Otherwise the
+/// GO_INTERSECTION_TRACE macro expands to nothing, and the
+/// functions below report no events. The functions reading or
+/// clearing the buffers must not be called while intersections are
+/// computed.
+namespace IntersectionTrace {
+
+    /// Current time in nanoseconds, measured from an arbitrary
+    /// starting point.
+    long long now();
+
+    /// Record one event for the calling thread.
+    /// \param event the case, of type IntersectionTraceEvent
+    /// \param depth the recursion depth
+    /// \param start start time as given by now()
+    /// \param end end time as given by now()
+    void record(int event, int depth, long long start, long long end);
+
+    /// Set the number of events kept per thread. Applies to threads
+    /// that have not recorded any events yet. Default is 65536.
+    void setBufferSize(size_t nmb_events);
+
+    /// Remove all recorded events and reset the counters.
+    void clear();
+
+    /// Get the number of times each case has been recorded and the
+    /// total time spent, summed over all threads.
+    /// \param count number of events, indexed by IntersectionTraceEvent
+    /// \param seconds total time, indexed by IntersectionTraceEvent
+    void getCounters(std::vector<long long>& count,
+		     std::vector<double>& seconds);
+
+    /// Name of an event
+    const char* eventName(int event);
+
+    /// Write the events kept in the buffers as a Chrome trace
+    /// (JSON). Load in chrome://tracing or Perfetto.
+    void writeChromeTrace(std::ostream& os);
+
+} // namespace IntersectionTrace
+
+
+/// Records an event from construction to destruction.
+class IntersectionTraceScope {
+public:
+    /// Constructor. Starts the clock.
+    IntersectionTraceScope(int event, int depth)
+	: event_(event), depth_(depth), start_(IntersectionTrace::now())
+    {}
+
+    /// Destructor. Records the event.
+    ~IntersectionTraceScope()
+    { IntersectionTrace::record(event_, depth_, start_,
+				IntersectionTrace::now()); }
+
+private:
+    int event_;
+    int depth_;
+    long long start_;
+};
+
+
+} // namespace Go
+
+
+#define GO_INTERSECTION_TRACE_CAT2(a, b) a##b
+#define GO_INTERSECTION_TRACE_CAT(a, b) GO_INTERSECTION_TRACE_CAT2(a, b)
+
+#ifdef GOTOOLS_INTERSECTION_TRACE
+/// Record \a event at recursion level \a depth for the rest of the
+/// enclosing scope. The arguments are not evaluated when tracing is
+/// not compiled in.
+#define GO_INTERSECTION_TRACE(event, depth)				\
+    Go::IntersectionTraceScope						\
+    GO_INTERSECTION_TRACE_CAT(go_intersection_trace_, __LINE__)(event, depth)
+#else
+#define GO_INTERSECTION_TRACE(event, depth)
+#endif
+
+
+#endif // _INTERSECTIONTRACE_H
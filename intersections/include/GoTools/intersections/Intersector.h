@@ -68,7 +68,8 @@ class Intersector {
 public:
 
     /// Default constructor
-    Intersector() : prev_intersector_(0) {}
+    Intersector() : prev_intersector_(0), parallel_subdivision_(false),
+		    parallel_max_depth_(0) {}
 
     /// Constructor.
     /// \param epsge the geometric tolerance for the intersector.
@@ -205,6 +206,29 @@ public:
     /// Write diagnostic information about the intersection points
     void writeIntersectionPoints() const;
 
+    /// Let sibling sub-intersectors run concurrently as tasks when
+    /// GoTools is compiled with OpenMP. Siblings sharing a sub-object
+    /// or an intersection point are still run in sequence, and their
+    /// pools are merged into the parent pool in the serial order, so
+    /// the result is identical to the one of the serial computation.
+    /// The topmost objects, common to all the siblings, are evaluated
+    /// with thread local evaluation state and geometry copies while
+    /// the tasks run. Sub-intersectors inherit the setting.
+    /// \param parallel if true, use task parallel subdivision.
+    /// \param max_depth tasks are only created down to this
+    /// recursion level. Deeper levels are computed serially within
+    /// their task.
+    void setParallelSubdivision(bool parallel, int max_depth = 6)
+    {
+	parallel_subdivision_ = parallel;
+	parallel_max_depth_ = max_depth;
+    }
+
+    /// Check if task parallel subdivision is selected.
+    /// \return True if sibling sub-intersectors may run concurrently.
+    bool parallelSubdivision() const
+    { return parallel_subdivision_; }
+
     friend class SfSfIntersector;
     friend class IntersectionPool;
 
@@ -220,6 +244,8 @@ protected:
     shared_ptr<GeoTol> epsge_;
     shared_ptr<SingularityInfo> singularity_info_;
     shared_ptr<ComplexityInfo> complexity_info_;
+    bool parallel_subdivision_;
+    int parallel_max_depth_;
 
     //     virtual shared_ptr<Intersector> 
     //       lowerOrderIntersector(shared_ptr<ParamObjectInt> obj1,
@@ -276,8 +302,21 @@ protected:
 	}
 
     virtual void printDebugInfo() = 0;
+
+    // Check if the intersection objects of this kind of intersector
+    // may be evaluated from concurrent sub-intersector tasks
+    virtual bool subIntersectorTasksSupported() const
+    { return false; }
+
 private:
 
+    // Compute the sub-intersectors, concurrently if possible
+    void computeSubIntersectors();
+
+    // Check if the sub-intersectors may be computed as concurrent
+    // tasks
+    bool subIntersectorTasksAllowed();
+
 };
 
 
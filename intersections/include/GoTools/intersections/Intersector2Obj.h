@@ -139,6 +139,12 @@ protected:
     shared_ptr<ParamGeomInt> obj_int_[2];
     int selfint_case_;
 
+    // Points, curves and surfaces evaluate their topmost shared
+    // ancestor safely from concurrent tasks, see
+    // ParamGeomInt::setInSharedTask()
+    virtual bool subIntersectorTasksSupported() const
+    { return true; }
+
     // NB: The order of the objects ot input is not arbitrary!  The
     // knowledge of what is the 'first object' and the 'second object'
     // can be used internally, and must be consistent with the parent
@@ -71,7 +71,7 @@ public:
     /// \param par the parameter in which to evaluate. The size of the
     /// array should be equal to numParams().
     virtual void point(Point& res, const double *par) const
-    { curve_->point(res, par[0]); }
+    { getParamCurve()->point(res, par[0]); }
 
     /// Evaluate the object in the input parameter, with the specified
     /// number of derivatives.
@@ -90,9 +90,10 @@ public:
 		       const bool* from_right = 0,
 		       double resolution = 1.0e-12) const 
     {
+	shared_ptr<const ParamCurve> crv = getParamCurve();
 	(from_right == 0)
-	    ? curve_->point(res, *par, der, true)
-	    : curve_->point(res, *par, der, from_right[0]);
+	    ? crv->point(res, *par, der, true)
+	    : crv->point(res, *par, der, from_right[0]);
     }
 
     /// Return a pointer to this object.
@@ -107,6 +108,8 @@ public:
     { return NULL; }
 
     /// Return pointer to the parametric curve defining this object.
+    /// Inside a parallel sub-intersector task, a topmost object
+    /// returns a copy private to the thread.
     /// \return Pointer to the parametric curve defining this object.
     shared_ptr<ParamCurve> getParamCurve();
 
@@ -43,6 +43,7 @@
 
 #include "GoTools/intersections/ParamObjectInt.h"
 #include "GoTools/intersections/BoundaryGeomInt.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 #include <memory>
 
 
@@ -54,6 +55,7 @@ class ParamPointInt;
 class ParamCurveInt;
 class ParamSurfaceInt;
 class DirectionCone;
+class GeomObject;
 
 
 /// This class is a base class providing an interface to the
@@ -181,9 +183,38 @@ public:
     /// parallell in a boundary point.
     virtual double getOptimizedConeAngle(Point& axis1, Point& axis2) = 0;
 
+    /// Mark the current thread as running a sub-intersector task, see
+    /// Intersector::setParallelSubdivision(). Objects with no ancestor
+    /// of the same type are shared between the tasks, directly and
+    /// through the intersection points. While the mark is set, such
+    /// objects are evaluated with a context owned by the thread, and
+    /// they hand out a private copy of their geometry.
+    /// \param in_task true if the thread enters a task.
+    /// \return the previous mark of the thread.
+    static bool setInSharedTask(bool in_task);
+
+    /// Release the private geometry copies made for the current
+    /// thread.
+    static void releaseThreadCopies();
+
 protected:
     std::vector<shared_ptr<BoundaryGeomInt> > boundary_obj_;
 
+    // Check if this object may be used by several sub-intersector
+    // tasks at the same time
+    bool sharedInTask() const;
+
+    // Evaluation context of the current thread
+    static SplineEvalContext& threadEvalContext();
+
+    // Scratch points of the current thread
+    static std::vector<Point>& threadScratchPoints();
+
+    // Private copy of the geometry of a shared object for the current
+    // thread, made on the first request
+    static shared_ptr<GeomObject>
+    threadCopy(const shared_ptr<GeomObject>& geom);
+
 };
 
     
@@ -73,7 +73,7 @@ public:
     /// \param tpar the parameter in which to evaluate. The size of
     /// the array should be equal to numParams().
     virtual void point(Point& pt, const double* tpar) const 
-    { surf_->point(pt, tpar[0], tpar[1]); }
+    { getParamSurface()->point(pt, tpar[0], tpar[1]); }
 
     /// Evaluate the object in the input parameter, with the specified
     /// number of derivatives.
@@ -92,12 +92,13 @@ public:
 		       const bool* from_right = 0,
 		       double resolution = 1.0e-12) const 
     {
+	shared_ptr<const ParamSurface> surf = getParamSurface();
 	if (from_right) {
-	    surf_->point(pt, tpar[0], tpar[1], derivs, from_right[0], 
-			 from_right[1], resolution);
+	    surf->point(pt, tpar[0], tpar[1], derivs, from_right[0], 
+			from_right[1], resolution);
 	} else {
-	    surf_->point(pt, tpar[0], tpar[1], derivs, true, true,
-			 resolution);
+	    surf->point(pt, tpar[0], tpar[1], derivs, true, true,
+			resolution);
 	}
     }
 
@@ -111,16 +112,18 @@ public:
 //     { return surf_;}
 
     /// Return pointer to the parametric surface defining this object.
+    /// Inside a parallel sub-intersector task, a topmost object
+    /// returns a copy private to the thread.
     /// \return Pointer to the parametric surface defining this
     /// object.
     shared_ptr<ParamSurface> getParamSurface()
-    { return surf_; }
+    { return sharedInTask() ? threadSurface() : surf_; }
 
     /// Return pointer to the parametric surface defining this object.
     /// \return Pointer to the parametric surface defining this
     /// object.
     shared_ptr<const ParamSurface> getParamSurface() const
-    { return surf_;}
+    { return sharedInTask() ? threadSurface() : surf_; }
 
     /// Return pointer to a subsurface of the parent surface for this
     /// object.  If no such surface exist, we use the surface of this
@@ -476,12 +479,12 @@ public:
 			  double& G) const
     {
 	// Getting first derivatives
-	surf_->point(temp_point_array_, u, v, 1,
-		     u_from_right, v_from_right); 
+	std::vector<Point>& pts = threadScratchPoints();
+	evalDerivs(pts, u, v, 1, u_from_right, v_from_right); 
 	
-	E = temp_point_array_[1] * temp_point_array_[1];
-	F = temp_point_array_[1] * temp_point_array_[2];
-	G = temp_point_array_[2] * temp_point_array_[2];
+	E = pts[1] * pts[1];
+	F = pts[1] * pts[2];
+	G = pts[2] * pts[2];
     }
 
     /// Return the coefficients necessary to calculate the second
@@ -507,17 +510,15 @@ public:
 			  double& N) const
     {
 	// Getting second derivatives
-	surf_->point(temp_point_array_, u, v, 2,
-		     u_from_right, v_from_right); 
+	std::vector<Point>& pts = threadScratchPoints();
+	evalDerivs(pts, u, v, 2, u_from_right, v_from_right); 
 	// Getting normal (we suppose that the surface contains a
 	// continuous first derivative...)
-	surf_->normal(temp_point_array_[0], u, v); // Setting first
-					           // point to normal
-					           // vec
+	evalNormal(pts[0], u, v); // Setting first point to normal vec
 
-	L = temp_point_array_[3] * temp_point_array_[0];  // d2r/du2 . N
-	M = temp_point_array_[4] * temp_point_array_[0];  // d2r/dudv . N
-	N = temp_point_array_[5] * temp_point_array_[0];  // d2r/dv2 . N
+	L = pts[3] * pts[0];  // d2r/du2 . N
+	M = pts[4] * pts[0];  // d2r/dudv . N
+	N = pts[5] * pts[0];  // d2r/dv2 . N
     }
 
     /// Return the partial derivatives in the input parameter point.
@@ -538,10 +539,10 @@ public:
 		bool from_right_1 = true,
 		bool from_right_2 = true) const
     {
-	surf_->point(temp_point_array_, u, v, 1,
-		     from_right_1, from_right_2);
-	deriv_u = temp_point_array_[1];
-	deriv_v = temp_point_array_[2];
+	std::vector<Point>& pts = threadScratchPoints();
+	evalDerivs(pts, u, v, 1, from_right_1, from_right_2);
+	deriv_u = pts[1];
+	deriv_v = pts[2];
     }
 
     /// Calculate the normal in the specified parameter point.
@@ -560,9 +561,9 @@ public:
 		bool from_right_1 = true,
 		bool from_right_2 = true) const
     {
-	surf_->point(temp_point_array_, u, v, 1,
-		     from_right_1, from_right_2);
-	normal = temp_point_array_[1] % temp_point_array_[2];
+	std::vector<Point>& pts = threadScratchPoints();
+	evalDerivs(pts, u, v, 1, from_right_1, from_right_2);
+	normal = pts[1] % pts[2];
     }
 
     /// Create a box containing the geometric sample mesh in the input
@@ -690,7 +691,24 @@ protected:
 // 				// nder
 //     std::vector<Point> gs_;     // Partial derivatives up to order
 // 				// nder
-    mutable std::vector<Point> temp_point_array_;
+
+    // Evaluate position and derivatives through point(), such that
+    // shared objects are evaluated safely inside parallel tasks
+    void evalDerivs(std::vector<Point>& pts, double u, double v,
+		    int derivs, bool u_from_right, bool v_from_right) const
+    {
+	double par[2] = { u, v };
+	bool from_right[2] = { u_from_right, v_from_right };
+	point(pts, par, derivs, from_right);
+    }
+
+    // Evaluate the surface normal
+    virtual void evalNormal(Point& normal, double u, double v) const
+    { getParamSurface()->normal(normal, u, v); }
+
+    // The copy of the surface private to the current thread
+    shared_ptr<ParamSurface> threadSurface() const
+    { return dynamic_pointer_cast<ParamSurface>(threadCopy(surf_)); }
 
     // Implicit objects
     shared_ptr<ImplicitizeSurfaceAlgo> impl_sf_algo_;
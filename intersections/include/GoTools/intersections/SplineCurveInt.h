@@ -77,6 +77,31 @@ public:
     virtual shared_ptr<ParamCurveInt> 
     makeIntObject(shared_ptr<ParamCurve> curve);
 
+    /// Evaluate the object in the input parameter. Inside a parallel
+    /// sub-intersector task, a topmost object is evaluated with the
+    /// evaluation context of the thread.
+    /// \param res the Point to be returned.
+    /// \param par the parameter in which to evaluate. The size of the
+    /// array should be equal to numParams().
+    virtual void point(Point& res, const double *par) const;
+
+    /// Evaluate the object in the input parameter, with the specified
+    /// number of derivatives.
+    /// \param res the Point to be returned.
+    /// \param par the parameter in which to evaluate. The size of
+    /// the array should be equal to numParams().
+    /// \param der the number of derivatives to calculate.
+    /// \param from_right if true the evaluation is to be performed
+    /// from the right side of the parameter value.
+    /// \param resolution tolerance used when determining whether
+    /// parameters are located at special values of the parameter
+    /// domain.
+    virtual void point(std::vector<Point>& res, 
+		       const double* par, 
+		       int der,
+		       const bool* from_right = 0,
+		       double resolution = 1.0e-12) const;
+
     /// Return true if the object has any inner knots in the specified
     /// parameter direction.
     /// \param pardir the parameter direction in question. Indexing
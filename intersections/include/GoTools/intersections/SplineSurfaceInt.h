@@ -87,6 +87,31 @@ public:
     virtual shared_ptr<ParamCurveInt> 
     makeIntCurve(shared_ptr<ParamCurve> crv, ParamGeomInt* parent);
 
+    /// Evaluate the object in the input parameter. Inside a parallel
+    /// sub-intersector task, a topmost object is evaluated with the
+    /// evaluation context of the thread.
+    /// \param pt the Point to be returned.
+    /// \param tpar the parameter in which to evaluate. The size of
+    /// the array should be equal to numParams().
+    virtual void point(Point& pt, const double* tpar) const;
+
+    /// Evaluate the object in the input parameter, with the specified
+    /// number of derivatives.
+    /// \param pt the vector of points to be returned.
+    /// \param tpar the parameter in which to evaluate. The size of
+    /// the array should be equal to numParams().
+    /// \param derivs the number of derivatives to calculate.
+    /// \param from_right if true the evaluation is to be performed
+    /// from the right side of the parameter value.
+    /// \param resolution tolerance used when determining whether
+    /// parameters are located at special values of the parameter
+    /// domain.
+    virtual void point(std::vector<Point>& pt, 
+		       const double* tpar, 
+		       int derivs,
+		       const bool* from_right = 0,
+		       double resolution = 1.0e-12) const;
+
     /// Return true if the object has any inner knots in the specified
     /// parameter direction.
     /// \param pardir the parameter direction in question. Indexing
@@ -266,6 +291,9 @@ public:
     void setImplicitDeg();
 
 protected:
+    // Evaluate the surface normal
+    virtual void evalNormal(Point& normal, double u, double v) const;
+
     // Data members
     shared_ptr<SplineSurface> spsf_;   // shared_ptr to
 					      // this surface
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __GLOBALENUMERATION_H
+#define __GLOBALENUMERATION_H
+
+
+#include <vector>
+
+
+namespace Go
+{
+
+  class BlockSolution;
+
+  // Global enumeration of the coefficients of one solution space in a block
+  // structured isogeometric model. Coefficients coinciding at matching block
+  // interfaces are given the same global index, and coefficients subject to
+  // Dirichlet conditions may be eliminated from the enumeration. The sparsity
+  // pattern of the system matrix is stored in compressed row format with one
+  // row per global coefficient, i.e. as a block pattern if the dimension of
+  // the solution space is larger than one. The columns of each row are sorted,
+  // so the position of a matrix entry is found with entryIndex(). As the
+  // pattern is fixed, the entries may be filled from several threads as long
+  // as concurrent updates of the same entry are protected.
+  //
+  // The enumeration is set up by a sequence of calls to addCoincident() and
+  // addDirichlet() followed by build(). IsogeometricVolModel and
+  // IsogeometricSfModel provide the complete set up in getGlobalEnumeration().
+
+  class GlobalEnumeration
+  {
+  public:
+    // Constructor. The solution spaces of all blocks in the model, all with
+    // the same dimension. The coefficient enumeration within each block is
+    // given by the order of the solution coefficients, the first parameter
+    // direction running fastest
+    GlobalEnumeration(const std::vector<BlockSolution*>& solutions);
+
+    // Destructor
+    ~GlobalEnumeration();
+
+    // Specify that coefficient coef1 in block block1 and coefficient coef2
+    // in block block2 coincide
+    void addCoincident(int block1, int coef1, int block2, int coef2);
+
+    // Specify that a coefficient is given by a Dirichlet condition
+    void addDirichlet(int block, int coef);
+
+    // Compute the global enumeration and the sparsity pattern. If
+    // eliminate_dirichlet is true, coefficients given by Dirichlet conditions
+    // are not part of the enumeration. If reorder is true, the global
+    // coefficients are permuted by the reverse Cuthill-McKee algorithm to
+    // reduce the bandwidth of the system matrix
+    void build(bool eliminate_dirichlet = true, bool reorder = true);
+
+    // Number of blocks
+    int nmbBlocks() const
+    { return (int)solutions_.size(); }
+
+    // Dimension of the solution space
+    int dimension() const
+    { return dim_; }
+
+    // Number of global coefficients, i.e. the number of rows in the pattern
+    int nmbGlobalCoefs() const
+    { return nmb_global_; }
+
+    // Number of distinct coefficients given by Dirichlet conditions
+    int nmbDirichletCoefs() const
+    { return nmb_dirichlet_; }
+
+    // Global index of a block local coefficient. Returns -1 if the coefficient
+    // is eliminated by a Dirichlet condition
+    int globalIndex(int block, int coef) const
+    { return global_[block_start_[block] + coef]; }
+
+    // Index among the distinct coefficients given by Dirichlet conditions.
+    // Returns -1 if the coefficient is not given by a Dirichlet condition
+    int dirichletIndex(int block, int coef) const
+    { return dirichlet_[block_start_[block] + coef]; }
+
+    // The global indices of all coefficients in one block, -1 for eliminated
+    // coefficients
+    const int* blockEnumeration(int block) const
+    { return &global_[block_start_[block]]; }
+
+    // Compressed row storage of the sparsity pattern. The columns of row i
+    // are col_index()[row_start()[i]], ..., col_index()[row_start()[i+1]-1],
+    // in increasing order
+    const std::vector<int>& rowStart() const
+    { return row_start_; }
+
+    const std::vector<int>& colIndex() const
+    { return col_index_; }
+
+    // Number of non-zero entries in the pattern
+    int nmbEntries() const
+    { return (int)col_index_.size(); }
+
+    // Position of the entry (row, col) in the compressed row storage.
+    // Returns -1 if the entry is not part of the pattern
+    int entryIndex(int row, int col) const;
+
+    // Largest distance between a row index and a column index in the pattern
+    int bandwidth() const;
+
+  private:
+    std::vector<BlockSolution*> solutions_;
+    int dim_;
+
+    // Start of each block in the vectors of block local coefficients
+    std::vector<int> block_start_;
+
+    // Parent in the union-find structure joining coincident coefficients
+    std::vector<int> parent_;
+    std::vector<bool> is_dirichlet_;
+
+    // The resulting enumeration of the block local coefficients
+    std::vector<int> global_;
+    std::vector<int> dirichlet_;
+    int nmb_global_;
+    int nmb_dirichlet_;
+
+    // Sparsity pattern
+    std::vector<int> row_start_;
+    std::vector<int> col_index_;
+
+    int findRoot(int idx);
+    void buildPattern();
+    void reverseCuthillMcKee(std::vector<int>& perm) const;
+  };
+
+} // end namespace Go
+
+
+#endif    // #ifndef __GLOBALENUMERATION_H
@@ -50,6 +50,7 @@
 #include "GoTools/isogeometric_model/IsogeometricModel.h"
 #include "GoTools/isogeometric_model/BdConditionType.h"
 #include "GoTools/isogeometric_model/IsogeometricSfBlock.h"
+#include "GoTools/isogeometric_model/GlobalEnumeration.h"
 
 
 namespace Go
@@ -135,6 +136,19 @@ namespace Go
     // Fetch all the single block defining this multi-block model
     void getIsogeometricBlocks(std::vector<shared_ptr<IsogeometricSfBlock> >& sfblock);
 
+    // Compute a global enumeration of the coefficients of one solution space
+    // in all blocks, and the corresponding sparsity pattern of the system
+    // matrix. Coefficients at matching block interfaces are merged, and
+    // coefficients given by Dirichlet boundary conditions are removed if
+    // eliminate_dirichlet is true. If reorder is true, the enumeration is
+    // permuted by the reverse Cuthill-McKee algorithm. The solution spaces
+    // must be consistent across the block interfaces, see
+    // updateSolutionSplineSpace(). Otherwise an exception is thrown
+    shared_ptr<GlobalEnumeration>
+      getGlobalEnumeration(int solutionspace_idx,
+			   bool eliminate_dirichlet = true,
+			   bool reorder = true) const;
+
   private:
     // The blocks which this block structured model consist of
     std::vector<shared_ptr<IsogeometricSfBlock> > sf_blocks_;
@@ -43,12 +43,14 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 #include "GoTools/utils/Point.h"
 #include "GoTools/compositemodel/SurfaceModel.h"
 #include "GoTools/trivariatemodel/VolumeModel.h"
 #include "GoTools/isogeometric_model/IsogeometricModel.h"
 #include "GoTools/isogeometric_model/BdConditionType.h"
 #include "GoTools/isogeometric_model/IsogeometricVolBlock.h"
+#include "GoTools/isogeometric_model/GlobalEnumeration.h"
 
 
 
@@ -129,6 +131,39 @@ namespace Go
     // Fetch all the single block defining this multi-block model
     void getIsogeometricBlocks(std::vector<shared_ptr<IsogeometricVolBlock> >& volblock);
 
+    // Compute a global enumeration of the coefficients of one solution space
+    // in all blocks, and the corresponding sparsity pattern of the system
+    // matrix. Coefficients at matching block interfaces are merged, and
+    // coefficients given by Dirichlet boundary conditions are removed if
+    // eliminate_dirichlet is true. If reorder is true, the enumeration is
+    // permuted by the reverse Cuthill-McKee algorithm. The solution spaces
+    // must be consistent across the block interfaces, see
+    // updateSolutionSplineSpace(). Otherwise an exception is thrown
+    shared_ptr<GlobalEnumeration>
+      getGlobalEnumeration(int solutionspace_idx,
+			   bool eliminate_dirichlet = true,
+			   bool reorder = true) const;
+
+    // Function applied to one element in forEachElement(). The arguments are the
+    // block index, the solution space of the block, the pre evaluated element data
+    // and the index of the calling thread
+    typedef std::function<void(int, const VolSolution&, const VolElementData&, int)>
+      ElementFunction;
+
+    // Apply a function to all elements of one solution space in all blocks. The
+    // elements are distributed on several threads when compiled with OpenMP, and
+    // the function must then be safe to call concurrently. The thread index given
+    // to the function is less than the number of threads returned by
+    // nmbElementThreads() and may be used to select per-thread storage, e.g. for
+    // local contributions to the system matrix.
+    // performPreEvaluation() must have been called for the solution space in all
+    // blocks. If the function throws, the exception of the first element in the
+    // block order is rethrown after the loop.
+    void forEachElement(int solutionspace_idx, const ElementFunction& func) const;
+
+    // The number of threads used in forEachElement()
+    int nmbElementThreads() const;
+
   private:
     // The blocks which this block structured model consist of
     std::vector<shared_ptr<IsogeometricVolBlock> > vol_blocks_;
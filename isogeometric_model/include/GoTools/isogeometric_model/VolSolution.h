@@ -76,6 +76,52 @@ namespace Go
     std::vector<double> deriv_u_;  // 1. derivative of the surface in 1. par. dir. in the Gauss points
     std::vector<double> deriv_v_;  // 1. derivative of the surface in 2. par. dir. in the Gauss points
     std::vector<double> deriv_w_;  // 1. derivative of the surface in 3. par. dir. in the Gauss points
+
+    // Elements, i.e. knot intervals containing Gauss points. Index of the first Gauss
+    // point in each element followed by the number of Gauss points in the parameter direction
+    std::vector<int> elem_gauss_u_;
+    std::vector<int> elem_gauss_v_;
+    std::vector<int> elem_gauss_w_;
+  };
+
+  // Pre evaluated data for one element (knot span box containing Gauss points) of
+  // a solution space, stored contiguously to allow sum factorisation in the assembly.
+  // The non-rational trivariate basis functions are products of one factor from each
+  // of the univariate tables basis_u_, basis_v_ and basis_w_. For each Gauss point
+  // in the element the tables hold the value and the first derivative of each of
+  // the order_[i] non-zero B-splines, i.e. nmb_gauss_[i]*order_[i]*2 values.
+  // The geometry data is stored for each Gauss point in the element, the 1. parameter
+  // direction running fastest.
+  struct VolElementData
+  {
+    int elem_[3];         // Element index in each parameter direction
+    int first_gauss_[3];  // Index of first Gauss point in each parameter direction
+    int nmb_gauss_[3];    // Number of Gauss points in each parameter direction
+    int first_coef_[3];   // Index of first non-zero basis function in each parameter direction
+    int order_[3];        // Number of non-zero basis functions in each parameter direction
+
+    std::vector<double> basis_u_;  // Univariate basis functions and derivatives, 1. par. dir.
+    std::vector<double> basis_v_;  // Univariate basis functions and derivatives, 2. par. dir.
+    std::vector<double> basis_w_;  // Univariate basis functions and derivatives, 3. par. dir.
+    std::vector<double> weights_;  // Weights of the non-zero basis functions, 1. par. dir.
+                                   // running fastest. Empty if the solution is non-rational
+
+    std::vector<double> points_;   // Position of the geometry volume, 3 values per point
+    std::vector<double> jacobian_; // Jacobian matrix of the geometry volume, 9 values per
+                                   // point: the derivatives in the 1., 2. and 3. par. dir.
+    std::vector<double> det_;      // Jacobian determinant
+
+    // Total number of Gauss points in the element
+    int nmbGaussPoints() const
+    {
+      return nmb_gauss_[0]*nmb_gauss_[1]*nmb_gauss_[2];
+    }
+
+    // Number of non-zero basis functions in the element
+    int nmbBasisFunctions() const
+    {
+      return order_[0]*order_[1]*order_[2];
+    }
   };
 
   // This class represents one solution in one block in a block-structured
@@ -267,6 +313,18 @@ namespace Go
                                                                         // 1. derivative in v_direction,
                                                                         // 1. derivative in w_direction
 
+    // Number of elements in one parameter direction, i.e. the number of knot
+    // intervals containing Gauss points. The first parameter direction has pardir = 0
+    // Requires pre evaluation to be performed
+    int nmbElements(int pardir) const;
+
+    // Fetch basis function factors and geometry information for all Gauss points
+    // in one element. The storage in data is reused, so the same instance should
+    // be passed for all elements visited by one thread.
+    // Requires pre evaluation to be performed
+    void getElementData(int elem_u, int elem_v, int elem_w,
+			VolElementData& data) const;
+
     // Attach coefficient information to specified solution
     virtual void setSolutionCoefficients(const std::vector<double>& coefs);
 
@@ -51,6 +51,17 @@ namespace Go
 				 const std::vector<LRSplineSurface::Refinement2D>& refs,
 				 bool single_insertions = false);
 
+    // Time the lookup of the elements containing the parameter pairs
+    // params = (u0, v0, u1, v1, ...). If use_locator is true the
+    // element locator of the surface is applied through coveringElement(),
+    // otherwise the mesh is searched for the element corner and the
+    // element is fetched from the element map. The found elements are
+    // returned in elements.
+    double benchmarkElementLookup(const LRSplineSurface& lr_sf,
+				  const std::vector<double>& params,
+				  bool use_locator,
+				  std::vector<Element2D*>& elements);
+
 }
 
 #endif // _LRBENCHMARKUTILS_H
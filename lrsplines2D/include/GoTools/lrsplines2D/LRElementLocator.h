@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRELEMENTLOCATOR_H
+#define _LRELEMENTLOCATOR_H
+
+#include <vector>
+#include <cstddef>
+
+namespace Go
+{
+
+// =============================================================================
+// Lookup of the element of an LR mesh containing a parameter pair.
+// The elements are given as rectangles numbered consecutively, and must
+// cover the parameter domain without overlap. A uniform bucket grid with
+// about two elements per bucket is laid over the domain, and each bucket
+// lists the elements overlapping it. The lists are stored contiguously,
+// thus the memory use is proportional to the number of elements and not
+// to the number of mesh cells spanned by the distinct knot values.
+class LRElementLocator
+// =============================================================================
+{
+ public:
+  // Construct empty locator
+  LRElementLocator();
+
+  // Set the number of elements. The domains must then be given by
+  // setDomain() before build() is called. Allocated storage is reused if
+  // possible.
+  void resize(int nmb_elem);
+
+  // Domain of element 'el'
+  void setDomain(int el, double umin, double vmin, double umax, double vmax)
+  {
+    double* dom = &domain_[4*el];
+    dom[0] = umin;
+    dom[1] = vmin;
+    dom[2] = umax;
+    dom[3] = vmax;
+  }
+
+  // Make the bucket grid from the element domains
+  void build();
+
+  int numElements() const { return (int)(domain_.size()/4); }
+
+  // Element domain, stored as umin, vmin, umax, vmax
+  const double* domain(int el) const { return &domain_[4*el]; }
+
+  // Number of the element containing the parameter pair (u,v), -1 if there
+  // are no elements. The elements are half open, [umin, umax) x [vmin, vmax),
+  // except at the end of the domain. Parameter pairs outside the domain are
+  // moved to the closest boundary.
+  int find(double u, double v) const;
+
+  // Whether element 'el' contains (u,v) by the rule of find()
+  bool contains(int el, double u, double v) const
+  {
+    const double* dom = &domain_[4*el];
+    return (u >= dom[0] && (u < dom[2] || (u == dom[2] && dom[2] >= umax_)) &&
+	    v >= dom[1] && (v < dom[3] || (v == dom[3] && dom[3] >= vmax_)));
+  }
+
+  // The memory used by the locator, in bytes
+  size_t memory() const;
+
+ private:
+  double umin_, umax_, vmin_, vmax_;
+  double ufac_, vfac_;    // Number of buckets per unit parameter
+  int nmb_u_, nmb_v_;
+
+  std::vector<double> domain_;
+  std::vector<size_t> bucket_start_;  // Offsets into bucket_elem_
+  std::vector<int> bucket_elem_;
+
+  // Range of buckets overlapping [t1, t2] in one parameter direction
+  static void bucketRange(double t1, double t2, double tmin, double fac,
+			  int nmb, int& ix1, int& ix2);
+};
+
+} // end namespace Go
+
+#endif // _LRELEMENTLOCATOR_H
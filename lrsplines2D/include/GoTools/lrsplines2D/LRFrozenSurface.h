@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRFROZENSURFACE_H
+#define _LRFROZENSURFACE_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "GoTools/lrsplines2D/LRSplineSurface.h"
+#include "GoTools/lrsplines2D/LRElementLocator.h"
+
+namespace Go
+{
+
+// =============================================================================
+// Compact, read-only snapshot of an LRSplineSurface.
+// The basis functions and elements of the surface are numbered consecutively
+// in the order of the surface maps, and all information needed for traversal
+// and evaluation is stored in contiguous arrays indexed by these numbers:
+// the knot values and coefficients of each basis function and, for each
+// element, its domain and the numbers of the basis functions with support in
+// it (and vice versa). Intended for read-mostly phases on large surfaces,
+// where traversing the maps of the surface dominates.
+// The snapshot does not follow changes to the surface. After a refinement,
+// or a change of coefficients through the surface, rebuild() must be called.
+class LRFrozenSurface
+// =============================================================================
+{
+ public:
+  // Construct empty snapshot
+  LRFrozenSurface();
+
+  // Construct snapshot of the given surface
+  explicit LRFrozenSurface(const LRSplineSurface& sf);
+
+  // Replace the contents by a snapshot of the given surface. The
+  // allocated storage is reused if possible.
+  void rebuild(const LRSplineSurface& sf);
+
+  // Copy the coefficients of the snapshot back into the surface, which
+  // must be the one the snapshot was built from and not be refined since.
+  void updateSurfaceCoefs(LRSplineSurface& sf) const;
+
+  // Fetch the coefficients, scaling factors and weights anew from the
+  // basis functions of the snapshot. Used when the coefficients of the
+  // surface are changed while the mesh is not.
+  void refreshCoefs();
+
+  // ----------------------------------------------------
+  // --------------- QUERY FUNCTIONS --------------------
+  // ----------------------------------------------------
+  bool empty() const { return (num_bsplines_ == 0); }
+  int dimension() const { return dim_; }
+  bool rational() const { return rational_; }
+  int degree(Direction2D d) const { return (d == XFIXED) ? deg_u_ : deg_v_; }
+  int numBasisFunctions() const { return num_bsplines_; }
+  int numElements() const { return num_elements_; }
+
+  // Knot values of basis function 'bs', degree(d)+2 values
+  const double* knots(int bs, Direction2D d) const
+  {
+    return (d == XFIXED) ? &bs_knots_u_[bs*(deg_u_+2)] :
+      &bs_knots_v_[bs*(deg_v_+2)];
+  }
+
+  // Coefficient (of size dimension()) multiplied by the gamma factor
+  const double* coefTimesGamma(int bs) const { return &coefs_[bs*dim_]; }
+  double* coefTimesGamma(int bs) { return &coefs_[bs*dim_]; }
+  double gamma(int bs) const { return gamma_[bs]; }
+  double weight(int bs) const { return weight_[bs]; }
+
+  // Element domain, stored as umin, vmin, umax, vmax
+  const double* elementDomain(int el) const { return locator_.domain(el); }
+
+  // Numbers of the basis functions with support in element 'el'
+  const int* elementSupportBegin(int el) const 
+  { return &elem_support_[0] + elem_support_start_[el]; }
+  const int* elementSupportEnd(int el) const
+  { return &elem_support_[0] + elem_support_start_[el+1]; }
+  int elementSupportSize(int el) const
+  { return elem_support_start_[el+1] - elem_support_start_[el]; }
+
+  // Numbers of the elements in the support of basis function 'bs'
+  const int* basisSupportBegin(int bs) const 
+  { return &bs_support_[0] + bs_support_start_[bs]; }
+  const int* basisSupportEnd(int bs) const
+  { return &bs_support_[0] + bs_support_start_[bs+1]; }
+  int basisSupportSize(int bs) const
+  { return bs_support_start_[bs+1] - bs_support_start_[bs]; }
+
+  // Objects in the surface corresponding to the numbers, and the other
+  // way around. The numbers are -1 for objects not in the snapshot.
+  LRBSpline2D* basisFunction(int bs) const { return bsplines_[bs]; }
+  Element2D* element(int el) const { return elements_[el]; }
+  int basisFunctionIndex(const LRBSpline2D* bspline) const;
+  int elementIndex(const Element2D* elem) const;
+
+  // Number of the element containing the parameter pair (u,v). Parameter
+  // pairs outside the domain are moved to the closest boundary.
+  int elementAt(double u, double v) const;
+
+  // ----------------------------------------------------
+  // ------------------ EVALUATION ----------------------
+  // ----------------------------------------------------
+  // Values, and optionally first derivatives, of the basis functions with
+  // support in element 'el' at the parameter pair (u,v), in the sequence
+  // given by elementSupportBegin(el). The basis functions are not scaled by 
+  // gamma, and the values are not divided by the rational denominator.
+  // The arrays must have room for elementSupportSize(el) values.
+  void basisValues(double u, double v, int el, double* vals,
+		   double* der_u = 0, double* der_v = 0) const;
+
+  // Values of the basis functions with support in element 'el' where the
+  // end of the support is handled as specified by the caller rather than
+  // per basis function, as in LRBSpline2D::evalBasisFunction
+  void basisValues(double u, double v, int el, bool u_at_end, bool v_at_end,
+		   double* vals) const;
+
+  // Evaluate the surface, the result is given in 'pt' which must have room
+  // for dimension() values. If 'el' is negative, the element is found by
+  // elementAt().
+  void point(double u, double v, double* pt, int el = -1) const;
+
+  // Evaluate the surface and its first derivatives
+  void point(double u, double v, double* pt, double* der_u, double* der_v,
+	     int el = -1) const;
+
+ private:
+  int dim_;
+  bool rational_;
+  int deg_u_;
+  int deg_v_;
+  int num_bsplines_;
+  int num_elements_;
+  double umin_, umax_, vmin_, vmax_;
+
+  // Per basis function data
+  std::vector<double> bs_knots_u_;      // (deg_u+2) knot values per function
+  std::vector<double> bs_knots_v_;      // (deg_v+2) knot values per function
+  std::vector<double> coefs_;           // dim coefficients times gamma
+  std::vector<double> gamma_;
+  std::vector<double> weight_;
+  std::vector<int> bs_support_start_;   // offsets into bs_support_
+  std::vector<int> bs_support_;         // element numbers
+  std::vector<LRBSpline2D*> bsplines_;
+
+  // Per element data. The element domains are kept by the locator
+  std::vector<int> elem_support_start_; // offsets into elem_support_
+  std::vector<int> elem_support_;       // basis function numbers
+  std::vector<Element2D*> elements_;
+  LRElementLocator locator_;
+
+  std::unordered_map<const LRBSpline2D*, int> bspline_index_;
+  std::unordered_map<const Element2D*, int> element_index_;
+
+  void accumulate(double u, double v, int el, bool derivs,
+		  double* pt, double* der_u, double* der_v) const;
+};
+
+} // end namespace Go
+
+#endif // _LRFROZENSURFACE_H
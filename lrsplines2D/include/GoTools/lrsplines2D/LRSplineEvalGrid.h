@@ -44,6 +44,7 @@
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/Element2D.h"
 #include "GoTools/lrsplines2D/Mesh2D.h"
+#include "GoTools/lrsplines2D/LRElementLocator.h"
 
 #include <vector>
 
@@ -80,6 +81,14 @@ public:
 
   LRSplineEvalGrid(LRSplineSurface& lr_spline);
 
+  /// Constructor. If bezier_extraction is set, the Bezier coefficients of
+  /// the surface in each element are computed once from the knot vectors
+  /// and coefficients of the B-splines with support in the element, and
+  /// used by evaluateBezier() and evalGrid(). The elements are then not
+  /// copied, and elements_begin() and elements_end() refer to an empty
+  /// range. Rational surfaces are not supported in this mode.
+  LRSplineEvalGrid(const LRSplineSurface& lr_spline, bool bezier_extraction);
+
   std::vector<Element2D>::iterator elements_begin()// const
     {
       return elements_.begin();
@@ -275,6 +284,53 @@ public:
       return orig_dom_;
     }
 
+  /// Whether the Bezier coefficients of the elements are computed
+  bool hasBezierExtraction() const
+  {
+    return bezier_;
+  }
+
+  /// Number of elements in the Bezier representation
+  int numBezierElements() const
+  {
+    return locator_.numElements();
+  }
+
+  /// Index of the element containing the parameter pair (u, v) given
+  /// in the original parameter domain. The elements are half open
+  /// except at the end of the domain. Requires Bezier extraction.
+  int bezierElement(double u, double v) const;
+
+  /// Bezier coefficients of element elem_ix, order_u*order_v*dim values
+  /// with the u index running fastest. Requires Bezier extraction.
+  const double* bezierCoefs(int elem_ix) const
+  {
+    return &bez_coefs_[(size_t)elem_ix*order_u_*order_v_*dim_];
+  }
+
+  /// Domain of element elem_ix, stored as umin, vmin, umax, vmax.
+  /// Requires Bezier extraction.
+  const double* bezierDomain(int elem_ix) const
+  {
+    return locator_.domain(elem_ix);
+  }
+
+  /// Evaluate the surface in (u, v), given in the original parameter
+  /// domain, from the Bezier coefficients of element elem_ix.
+  /// The result has the dimension of the surface. Requires Bezier
+  /// extraction.
+  void evaluateBezier(int elem_ix, double u, double v, double *res) const;
+
+  /// Evaluate the surface in a regular grid of num_u x num_v points in
+  /// the given parameter domain. The points are appended to points with
+  /// u running fastest, as in LRSplineSurface::evalGrid(). The grid rows
+  /// are evaluated in parallel if OpenMP is enabled. Requires Bezier
+  /// extraction.
+  void evalGrid(int num_u, int num_v, 
+		double umin, double umax, 
+		double vmin, double vmax,
+		std::vector<double>& points) const;
+
 
 private:
 	RectDomain orig_dom_;
@@ -282,7 +338,19 @@ private:
   int order_u_;
   int order_v_;
   int dim_;
-  Mesh2D mesh_;
+  const Mesh2D* mesh_;  // The mesh of the surface, not copied
+
+  // Bezier representation of the surface. The coefficients of element i
+  // for the Bernstein polynomials B_k(s)*B_l(t), where s and t are the local
+  // parameters of the element scaled to [0,1], are stored from
+  // bez_coefs_[i*order_u_*order_v_*dim_] with the index running fastest
+  // in k, then in l, with the dimension innermost
+  bool bezier_;
+  LRElementLocator locator_;         // Element domains and lookup
+  std::vector<double> bez_coefs_;
+
+  // Compute the Bezier coefficients of all elements
+  void bezierExtraction(const LRSplineSurface& lr_spline);
 
 
 };
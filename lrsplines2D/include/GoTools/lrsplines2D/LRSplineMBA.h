@@ -42,6 +42,7 @@
 
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/LRBSpline2D.h"
+#include "GoTools/lrsplines2D/LRFrozenSurface.h"
 #include "GoTools/utils/Point.h"
 
 namespace Go
@@ -50,11 +51,17 @@ namespace Go
   namespace LRSplineMBA
   {
     // Update LRSplineSurface according to data points stored in the surface elements
-    // using the MBA algorithm
-    void MBADistAndUpdate(LRSplineSurface *srf);
-    void MBADistAndUpdate_omp(LRSplineSurface *srf);
-    void MBAUpdate(LRSplineSurface *srf);
-    void MBAUpdate_omp(LRSplineSurface *srf);
+    // using the MBA algorithm. The traversal uses the arrays of a snapshot
+    // of the surface rather than the maps of the surface. The snapshot is
+    // made once for each refinement level by the caller, as it must be
+    // rebuilt after each refinement of the surface, while changes of
+    // coefficients are picked up automatically. The coefficients of the
+    // snapshot are updated along with those of the surface.
+    void MBADistAndUpdate(LRSplineSurface *srf, LRFrozenSurface& frozen);
+    void MBADistAndUpdate_omp(LRSplineSurface *srf, LRFrozenSurface& frozen);
+    void MBAUpdate(LRSplineSurface *srf, LRFrozenSurface& frozen);
+    void MBAUpdate_omp(LRSplineSurface *srf, LRFrozenSurface& frozen);
+
     void MBAUpdate(LRSplineSurface *srf, std::vector<Element2D*>& elems,
 		   std::vector<Element2D*>& elems2);
 
@@ -661,6 +661,9 @@ namespace Go
 
  private:
 
+  // Reads and writes the surface in the binary g2 format
+  friend class LRSplineSurfaceBinaryCodec;
+
   // ----------------------------------------------------
   // ----------------- PRIVATE DATA ---------------------
   // ----------------------------------------------------
@@ -680,6 +683,25 @@ namespace Go
   mutable RectDomain domain_;
   mutable Element2D* curr_element_;
 
+  // Uniform bucket grid over the parameter domain, used to locate the
+  // element containing a parameter pair in constant expected time. Each
+  // bucket lists the elements overlapping it. Maintained by the functions
+  // changing the element map. After a local refinement the new elements
+  // are added, while split elements are left in their old buckets.
+  struct ElementLocator
+  {
+    ElementLocator() 
+      : umin(0.0), umax(0.0), vmin(0.0), vmax(0.0), ufac(0.0), vfac(0.0),
+	nmb_u(0), nmb_v(0), nmb_built(0)
+    {}
+    double umin, umax, vmin, vmax;
+    double ufac, vfac;  // Number of buckets per unit parameter
+    int nmb_u, nmb_v;
+    int nmb_built;      // Number of elements when the grid was made
+    std::vector<std::vector<Element2D*> > buckets;
+  };
+  ElementLocator elem_locator_;
+
    // Private constructor given mesh and LR B-splines
   LRSplineSurface(double knot_tol, bool rational,
 		  Mesh2D& mesh, std::vector<std::unique_ptr<LRBSpline2D> >& b_splines);
@@ -693,6 +715,16 @@ namespace Go
   // Locate all elements in a mesh
   static ElementMap construct_element_map_(const Mesh2D&, const BSplineMap&);
 
+  // Make the element locator from the current element map
+  void build_element_locator_();
+
+  // Register a new element in the element locator
+  void add_to_element_locator_(Element2D* elem);
+
+  // Find the element containing (u,v) by the element locator. Returns
+  // NULL if no element is found.
+  Element2D* locate_element_(double u, double v) const;
+
   // Collect all LR B-splines overlapping a specified area
 //    std::vector<std::unique_ptr<LRBSpline2D> > 
     std::vector<LRBSpline2D*> 
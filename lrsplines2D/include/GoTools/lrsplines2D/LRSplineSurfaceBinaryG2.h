@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRSPLINESURFACEBINARYG2_H
+#define _LRSPLINESURFACEBINARYG2_H
+
+#include "GoTools/geometry/BinaryG2.h"
+
+namespace Go
+{
+
+class Mesh2D;
+
+/// Stores an LRSplineSurface in binary g2 files as raw blocks: the
+/// mesh knots and mesh rectangles, and for each LR B-spline the knot
+/// indices, the coefficient, gamma and the weight.
+class LRSplineSurfaceBinaryCodec : public BinaryG2Codec
+{
+public:
+    virtual void write(const GeomObject& obj, BinaryG2Writer& writer) const;
+
+    virtual GeomObject* read(BinaryG2Reader& reader) const;
+
+private:
+    static void writeMesh(const Mesh2D& mesh, BinaryG2Writer& writer);
+    static void readMesh(BinaryG2Reader& reader, Mesh2D& mesh);
+};
+
+namespace BinaryG2
+{
+    /// Register \ref LRSplineSurfaceBinaryCodec for LRSplineSurface.
+    /// Without it, LR spline surfaces are stored as ASCII g2 text,
+    /// which requires LRSplineSurface to be registered with the
+    /// Factory when reading.
+    void registerLRSplineSurface();
+
+} // namespace BinaryG2
+
+} // namespace Go
+
+#endif // _LRSPLINESURFACEBINARYG2_H
@@ -279,6 +279,7 @@ LRSplineSurface::LRSplineSurface(int deg_u,
   }
   // Identifying all elements and mapping the basis functions to them
   emap_ = construct_element_map_(mesh_, bsplines_);
+  build_element_locator_();
 }
 
 //==============================================================================
@@ -318,6 +319,7 @@ LRSplineSurface::LRSplineSurface(int deg_u,
     }
   }
   emap_ = construct_element_map_(mesh_, bsplines_);
+  build_element_locator_();
 }
 
 }; // end namespace Go
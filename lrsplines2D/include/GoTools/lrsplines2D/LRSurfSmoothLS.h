@@ -58,6 +58,7 @@
 #include <vector>
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/LRBSpline2D.h"
+#include "GoTools/lrsplines2D/LRFrozenSurface.h"
 
 namespace Go
 {
@@ -144,24 +145,54 @@ class LRSurfSmoothLS
   int ncond_;                        // Number of unknown coefficients
 
   /// Storage of the equation system.
-  std::vector<double> gmat_;         // Matrix at left side of equation system.  
+  // The matrix at the left side is stored in compressed row format. The
+  // entries are given by the pairs of LR B-splines with a free coefficient
+  // having a common element in their support
+  std::vector<double> gmat_;         // Entries of matrix at left side of equation system.  
+  std::vector<int> grow_;            // Index of first entry in each row, size ncond_+1
+  std::vector<int> gcol_;            // Column of each entry, increasing within rows
   std::vector<double> gright_;       // Right side of equation system.      
  
-  BsplineIndexMap BSmap_;   // Indices to all LR B-splines to associate
-                            // a posistion in the stiffness matrix
+  LRFrozenSurface frozen_;  // Snapshot of the surface traversed when
+                            // setting up the equation system
+  std::vector<int> free_ix_; // Position in the stiffness matrix of each
+                             // LR B-spline in the snapshot, -1 if the
+                             // coefficient is fixed
+
+  // Set ncond_ and free_ix_ from the fixed coefficients in the snapshot
+  void setFreeIndices();
 
   // Compute the least squares contributions to the stiffness matrix and
-  // the right hand side for a specified set of B-splines
+  // the right hand side for the B-splines in the support of element 'el'
+  // in the snapshot
   void localLeastSquares(std::vector<double>& points, 
 			 std::vector<double>& ghost_points,
-			 const std::vector<LRBSpline2D*>& bsplines,
-			 double* mat, double* right, int ncond);
+			 int el, double* mat, double* right, int ncond);
 
   void localLeastSquares_omp(std::vector<double>& points, 
 			     std::vector<double>& ghost_points,
 			     const std::vector<LRBSpline2D*>& bsplines,
 			     double* mat, double* right, int ncond);
 
+  // Compute the sparsity pattern of the matrix at the left side and
+  // allocate storage for the equation system
+  void setSparsityPattern();
+
+  // Column indices of the row of the LR B-spline with index kb in the
+  // snapshot, sorted and without duplicates
+  void sparsityRow(int kb, std::vector<int>& row) const;
+
+  // Position in gmat_ of the entry (ix1, ix2)
+  int matrixIndex(size_t ix1, size_t ix2) const;
+
+  // Add the local least squares matrix and right hand side of element
+  // 'el' in the snapshot to the equation system
+  void addLocalLeastSquares(int el, double weight);
+
+  // Divide the elements of the snapshot into groups where no elements in
+  // the same group share a B-spline with a free coefficient
+  void groupElements(std::vector<std::vector<int> >& groups) const;
+
   std::vector<double> getBasisValues(const std::vector<LRBSpline2D*>& bsplines,
 				     double *par);
 
@@ -178,19 +209,25 @@ class LRSurfSmoothLS
 			    double tmax, int& nmbGauss);
 
   void computeDer1Integrals(const std::vector<LRBSpline2D*>& bsplines, 
-			    int nmbGauss, double* basis_derivs, double weight);
+			    const int* free_ix, int nmbGauss, 
+			    double* basis_derivs, double weight);
   void computeDer1LineIntegrals(const std::vector<LRBSpline2D*>& bsplines, 
-				int nmbGauss, double* basis_derivs, double weight);
+				const int* free_ix, int nmbGauss, 
+				double* basis_derivs, double weight);
 
   void computeDer2Integrals(const std::vector<LRBSpline2D*>& bsplines, 
-			    int nmbGauss, double* basis_derivs, double weight);
+			    const int* free_ix, int nmbGauss, 
+			    double* basis_derivs, double weight);
   void computeDer2LineIntegrals(const std::vector<LRBSpline2D*>& bsplines, 
-				int nmbGauss, double* basis_derivs, double weight);
+				const int* free_ix, int nmbGauss, 
+				double* basis_derivs, double weight);
 
   void computeDer3Integrals(const std::vector<LRBSpline2D*>& bsplines, 
-			    int nmbGauss, double* basis_derivs, double weight);
+			    const int* free_ix, int nmbGauss, 
+			    double* basis_derivs, double weight);
   void computeDer3LineIntegrals(const std::vector<LRBSpline2D*>& bsplines, 
-				int nmbGauss, double* basis_derivs, double weight);
+				const int* free_ix, int nmbGauss, 
+				double* basis_derivs, double weight);
 
   std::vector<LRBSpline2D*> 
     bsplinesCoveringElement(std::vector<LRBSpline2D*>& cand, 
@@ -253,6 +253,9 @@ public:
 
  private:
 
+  // Reads and writes the mesh in the binary g2 format
+  friend class LRSplineSurfaceBinaryCodec;
+
   // --------------------
   // --- PRIVATE DATA --- 
   // --------------------
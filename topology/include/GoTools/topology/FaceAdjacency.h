@@ -44,21 +44,35 @@
 
 #include "GoTools/utils/Point.h"
 #include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/BoxHierarchy.h"
 #include "GoTools/utils/errormacros.h"
 #include "GoTools/geometry/ClassType.h"
 #include "GoTools/geometry/CurveOnSurface.h"
+#include "GoTools/geometry/BoundedSurface.h"
 #include "GoTools/geometry/LineCloud.h"
 #include "GoTools/topology/FaceConnectivity.h"
 #include "GoTools/topology/tpTolerances.h"
 
 #include <vector>
 #include <set>
+#include <map>
 #include <memory>
 #include <fstream>
+#include <algorithm>
+#include <functional>
 
 namespace Go
 {
 
+/// Run the tasks 0, ..., nmb_tasks-1 of FaceAdjacency::computeAdjacency.
+/// The tasks are spread over the threads when GoTools is compiled with
+/// OpenMP, and run in sequence otherwise. If tasks throw, the exception
+/// of the lowest task index is rethrown after all tasks are finished.
+/// \param nmb_tasks the number of tasks
+/// \param task function running the task with the given index
+void runFaceAdjacencyTasks(int nmb_tasks,
+			   const std::function<void(int)>& task);
+
 /// Helper class for marching
 class MarchPoint
 {
@@ -161,7 +175,7 @@ public:
 		       int first_idx)
     //=======================================================================
     {
-      int i, j, k, l;
+      int i;
       int num_faces = (int)faces.size();
       std::vector<Go::BoundingBox> boxes;
       boxes.reserve(num_faces);
@@ -173,116 +187,57 @@ public:
 
       orient_inconsist.clear();
 
-      std::vector<shared_ptr<edgeType> > startedges0, startedges1;
-      for (i = 0; i < num_faces - 1; ++i) {
-	int first = std::max(first_idx, i+1);
-	for (j = first; j < num_faces; ++j) {
-	  // For every combination of faces, do a boxtest.
-	  if (boxes[i].overlaps(boxes[j], tol_.neighbour)) {
-	    // We have some possible neighbourhood incidents.
-	    // Now do a box test on every combination of edges
-	    startedges0 = faces[i]->startEdges();
-	    startedges1 = faces[j]->startEdges();
-	    // Testing all loops in one surface against
-	    // all loops in the other.
-	    for (k = 0; k < int(startedges0.size()); ++k) {
-	      for (l = 0; l < int(startedges1.size()); ++l) {
-		edgeType* s0 = startedges0[k].get();
-		edgeType* s1 = startedges1[l].get();
-		if (s0 ==0 || s1 == 0) break;
-		edgeType* e[2];
-		e[0] = s0;
-		e[1] = s1;
-		edgeType* en[2];
-		bool finished = false;
-		while(!finished) {
-		  en[0] = e[0]->next();
-		  en[1] = e[1]->next();
-		  if (e[0]->twin() && e[0]->twin() == e[1] &&
-		      e[1]->twin() && e[1]->twin() == e[0])
-		    {
-		      // Already tested in the context of edge split
-		      ;
-		    }
-		  else if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
-						   tol_.neighbour)) {
-#ifdef DEBUG
-		  std::ofstream debug("top_debug.g2");
-		  for (int ki = 0; ki < 2; ++ki) {
-		    e[ki]->face()->surface()->writeStandardHeader(debug);
-		    e[ki]->face()->surface()->write(debug);
-		    std::vector<double> pts(12);
-		    Point from = e[ki]->point(e[ki]->tMin());
-		    double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
-		    Point mid = e[ki]->point(tmid);
-		    Point to = e[ki]->point(e[ki]->tMax());
-		    std::copy(from.begin(), from.end(), pts.begin());
-		    std::copy(mid.begin(), mid.end(), pts.begin() + 3);
-		    std::copy(mid.begin(), mid.end(), pts.begin() + 6);
-		    std::copy(to.begin(), to.end(), pts.begin() + 9);
-		    LineCloud lc(pts.begin(), 2);
-		    lc.writeStandardHeader(debug);
-		    lc.write(debug);
-		  }
-#endif
-		    // We found an edge overlap. Possible incident.
-		    int incident_occurred = 
-		      testEdges(e);
-		    if (incident_occurred) {
-		      // We skip the rest of this subloop (looping
-		      // over edges e[1] in face faces[j]) by
-		      // making en[1] so that e[0] will be
-		      // incremented.
-		      // If e[0] was split w/t-value higher than
-		      // start value, do not forget first part of
-		      // edge.
-
-		      if (incident_occurred >= 2)
-			{
-			  // Inconsistence in face orientation
-			  // Remember incident
-			  // Check if it has occured before
-			  size_t kr;
-			  for (kr=0; kr<orient_inconsist.size(); ++kr)
-			    if ((orient_inconsist[kr].first == faces[i].get() &&
-				 orient_inconsist[kr].second == faces[j].get()) ||
-				(orient_inconsist[kr].first == faces[j].get() &&
-				 orient_inconsist[kr].second == faces[i].get()))
-			      break;
-
-			  if (kr == orient_inconsist.size())
-			    orient_inconsist.push_back(std::make_pair(faces[i].get(),
-								      faces[j].get()));
-			}
-		    }
-		  }
-
-		  // 17102017. Adjacency analysis functions with an incremental addition
-		  // of faces have a special security net for sliver faces. This may
-		  // need to be included here. 
-
-		  // Just to be sure in case the edge loop has changed
-		  startedges0 = faces[i]->startEdges();
-		  startedges1 = faces[j]->startEdges();
-		  edgeType* s0 = startedges0[k].get();
-		  edgeType* s1 = startedges1[l].get();
-		  if (s0 ==0 || s1 == 0) 
-		    break;
-		  // Pick next edges, check if we're done
-		  //e[1] = en[1];
-		  e[1] = e[1]->next();
-		  if (e[1] == s1) {
-		    //e[0] = en[0];
-		    e[0] = e[0]->next();
-		    if (e[0] == s0)
-		      finished = true;
-		  }
-		}
-	      }
+      // Find the face pairs with overlapping boxes and some pair of
+      // overlapping edge boxes. Only these can be adjacent. The edges
+      // created by splitting lie inside the box of the original edge,
+      // so the remaining pairs are never matched. The pairs are visited
+      // in the same order as when testing every combination
+      std::vector<std::pair<int,int> > pairs;
+      overlappingFaces(faces, boxes, first_idx, pairs);
+
+      // Faces that may be touched by the same edge split belong to the
+      // same group. Different groups are independent and may be
+      // matched concurrently
+      std::vector<int> group;
+      int nmb_groups = groupFaces(faces, pairs, group);
+      std::vector<std::vector<size_t> > group_pairs(nmb_groups);
+      for (size_t kr = 0; kr < pairs.size(); ++kr)
+	group_pairs[group[pairs[kr].first]].push_back(kr);
+      std::vector<std::vector<size_t> > tasks;
+      for (int kg = 0; kg < nmb_groups; ++kg)
+	if (group_pairs[kg].size() > 0)
+	  tasks.push_back(group_pairs[kg]);
+
+      if (tasks.size() > 1) {
+	int nmb_tasks = (int)tasks.size();
+	std::vector<char> inconsist(pairs.size(), 0);
+	std::vector<std::vector<shared_ptr<edgeType> > > task_edges(nmb_tasks);
+	runFaceAdjacencyTasks(nmb_tasks, [&](int kt) {
+	    // Edges created by splitting are collected separately for
+	    // each task
+	    FaceAdjacency<edgeType, faceType> local(tol_);
+	    for (size_t kr = 0; kr < tasks[kt].size(); ++kr) {
+	      size_t idx = tasks[kt][kr];
+	      inconsist[idx] = local.matchFaces(faces, pairs[idx].first,
+						pairs[idx].second) ? 1 : 0;
 	    }
-	  }
-	}
+	    task_edges[kt].swap(local.new_edges_);
+	  });
+
+	for (int kt = 0; kt < nmb_tasks; ++kt)
+	  new_edges_.insert(new_edges_.end(), task_edges[kt].begin(),
+			    task_edges[kt].end());
+	for (size_t kr = 0; kr < pairs.size(); ++kr)
+	  if (inconsist[kr])
+	    addInconsistency(faces[pairs[kr].first].get(),
+			     faces[pairs[kr].second].get(), orient_inconsist);
+	return;
       }
+
+      for (size_t kr = 0; kr < pairs.size(); ++kr)
+	if (matchFaces(faces, pairs[kr].first, pairs[kr].second))
+	  addInconsistency(faces[pairs[kr].first].get(),
+			   faces[pairs[kr].second].get(), orient_inconsist);
     }
 
     //=======================================================================
@@ -1006,7 +961,317 @@ public:
     
  private:
 
+    //=======================================================================
+    /// Find the pairs (i, j), i < j and j >= first_idx, of faces with
+    /// overlapping boxes and some pair of overlapping edge boxes. The edge
+    /// boxes are kept in a box hierarchy, so each edge is only tested
+    /// against the edges close to it. The pairs are sorted
+    void overlappingFaces(const std::vector<shared_ptr<faceType> >& faces,
+			  const std::vector<Go::BoundingBox>& boxes,
+			  int first_idx,
+			  std::vector<std::pair<int,int> >& pairs) const
+    //=======================================================================
+    {
+      int num_faces = (int)faces.size();
+      std::vector<std::vector<Go::BoundingBox> > edge_boxes(num_faces);
+      std::vector<double> coords;
+      std::vector<int> edge_face, edge_idx;
+      std::vector<int> unbounded;  // Faces with an edge without a proper box
+      for (int ki = 0; ki < num_faces; ++ki) {
+	edgeBoxes(faces[ki], edge_boxes[ki]);
+	bool bounded = true;
+	for (size_t kj = 0; kj < edge_boxes[ki].size(); ++kj) {
+	  const Go::BoundingBox& box = edge_boxes[ki][kj];
+	  if (!properBox(box)) {
+	    bounded = false;
+	    continue;
+	  }
+	  // The hierarchy is 3D. Missing coordinates are set to zero,
+	  // further coordinates are tested on the boxes themselves
+	  int dim = box.dimension();
+	  for (int kd = 0; kd < 3; ++kd)
+	    coords.push_back(kd < dim ? box.low()[kd] : 0.0);
+	  for (int kd = 0; kd < 3; ++kd)
+	    coords.push_back(kd < dim ? box.high()[kd] : 0.0);
+	  edge_face.push_back(ki);
+	  edge_idx.push_back((int)kj);
+	}
+	if (!bounded)
+	  unbounded.push_back(ki);
+      }
+
+      Go::BoxHierarchy hierarchy;
+      hierarchy.build(coords, 4);
+      std::vector<std::vector<int> > candidates(num_faces);
+      std::vector<int> found;
+      for (int ke = 0; ke < (int)edge_face.size(); ++ke) {
+	int i1 = edge_face[ke];
+	const Go::BoundingBox& box1 = edge_boxes[i1][edge_idx[ke]];
+	hierarchy.overlappingBoxes(hierarchy.box(ke), tol_.neighbour, found);
+	for (size_t kr = 0; kr < found.size(); ++kr) {
+	  int i2 = edge_face[found[kr]];
+	  if (i2 > i1 && i2 >= first_idx &&
+	      box1.overlaps(edge_boxes[i2][edge_idx[found[kr]]],
+			    tol_.neighbour))
+	    candidates[i1].push_back(i2);
+	}
+      }
+
+      // An edge without a proper box may be close to any other edge
+      for (size_t ki = 0; ki < unbounded.size(); ++ki) {
+	int i1 = unbounded[ki];
+	for (int i2 = 0; i2 < num_faces; ++i2)
+	  if (i2 != i1 && edge_boxes[i2].size() > 0 &&
+	      std::max(i1, i2) >= first_idx)
+	    candidates[std::min(i1, i2)].push_back(std::max(i1, i2));
+      }
+
+      pairs.clear();
+      for (int ki = 0; ki < num_faces; ++ki) {
+	std::sort(candidates[ki].begin(), candidates[ki].end());
+	candidates[ki].erase(std::unique(candidates[ki].begin(),
+					 candidates[ki].end()),
+			     candidates[ki].end());
+	for (size_t kj = 0; kj < candidates[ki].size(); ++kj) {
+	  int i2 = candidates[ki][kj];
+	  if (!properBox(boxes[ki]) || !properBox(boxes[i2]) ||
+	      boxes[ki].overlaps(boxes[i2], tol_.neighbour))
+	    pairs.push_back(std::make_pair(ki, i2));
+	}
+      }
+    }
+
+    /// Boxes that are not valid or have no dimension overlap all others
+    static bool properBox(const Go::BoundingBox& box)
+    {
+      return box.valid() && box.dimension() > 0;
+    }
+
+    //=======================================================================
+    /// Collect the boxes of the edges in all loops of a face
+    static void edgeBoxes(const shared_ptr<faceType>& face,
+			  std::vector<Go::BoundingBox>& boxes)
+    //=======================================================================
+    {
+      std::vector<shared_ptr<edgeType> > startedges = face->startEdges();
+      for (size_t ki = 0; ki < startedges.size(); ++ki) {
+	edgeType* orig = startedges[ki].get();
+	edgeType* e1 = orig;
+	while (e1) {
+	  boxes.push_back(e1->boundingBox());
+	  e1 = e1->next();
+	  if (e1 == orig)
+	    break;
+	}
+      }
+    }
 
+    //=======================================================================
+    /// Split the faces into groups that can be matched independently of
+    /// each other. The faces of a pair to be matched, faces connected
+    /// through twin edges and faces sharing the same underlying surface
+    /// end up in the same group. Returns the number of groups. If some face
+    /// has a twin outside the face set, all faces are put in one group
+    int groupFaces(const std::vector<shared_ptr<faceType> >& faces,
+		   const std::vector<std::pair<int,int> >& pairs,
+		   std::vector<int>& group) const
+    //=======================================================================
+    {
+      int num_faces = (int)faces.size();
+      group.assign(num_faces, 0);
+      std::vector<int> parent(num_faces);
+      for (int ki = 0; ki < num_faces; ++ki)
+	parent[ki] = ki;
+
+      for (size_t kr = 0; kr < pairs.size(); ++kr)
+	joinGroups(parent, pairs[kr].first, pairs[kr].second);
+
+      std::map<faceType*, int> face_idx;
+      std::map<ParamSurface*, int> surf_idx;
+      for (int ki = 0; ki < num_faces; ++ki) {
+	face_idx[faces[ki].get()] = ki;
+	shared_ptr<ParamSurface> surf = faces[ki]->surface();
+	shared_ptr<BoundedSurface> bd_surf =
+	  dynamic_pointer_cast<BoundedSurface, ParamSurface>(surf);
+	if (bd_surf.get())
+	  surf = bd_surf->underlyingSurface();
+	typename std::map<ParamSurface*, int>::iterator it =
+	  surf_idx.find(surf.get());
+	if (it == surf_idx.end())
+	  surf_idx[surf.get()] = ki;
+	else
+	  joinGroups(parent, it->second, ki);
+      }
+
+      for (int ki = 0; ki < num_faces; ++ki) {
+	std::vector<shared_ptr<edgeType> > startedges = faces[ki]->startEdges();
+	for (size_t kj = 0; kj < startedges.size(); ++kj) {
+	  edgeType* orig = startedges[kj].get();
+	  edgeType* e1 = orig;
+	  while (e1) {
+	    if (e1->twin()) {
+	      typename std::map<faceType*, int>::iterator it =
+		face_idx.find(e1->twin()->face());
+	      if (it == face_idx.end())
+		return 1;  // Splitting may affect faces outside the set
+	      joinGroups(parent, ki, it->second);
+	    }
+	    e1 = e1->next();
+	    if (e1 == orig)
+	      break;
+	  }
+	}
+      }
+
+      int nmb_groups = 0;
+      std::vector<int> root_group(num_faces, -1);
+      for (int ki = 0; ki < num_faces; ++ki) {
+	int root = findGroup(parent, ki);
+	if (root_group[root] < 0)
+	  root_group[root] = nmb_groups++;
+	group[ki] = root_group[root];
+      }
+      return nmb_groups;
+    }
+
+    /// Union-find helpers for groupFaces
+    static int findGroup(std::vector<int>& parent, int idx)
+    {
+      while (parent[idx] != idx) {
+	parent[idx] = parent[parent[idx]];
+	idx = parent[idx];
+      }
+      return idx;
+    }
+
+    static void joinGroups(std::vector<int>& parent, int idx1, int idx2)
+    {
+      int root1 = findGroup(parent, idx1);
+      int root2 = findGroup(parent, idx2);
+      if (root1 != root2)
+	parent[std::max(root1, root2)] = std::min(root1, root2);
+    }
+
+    //=======================================================================
+    /// Remember a pair of adjacent faces with inconsistent orientation,
+    /// unless the pair is registered already
+    static void
+      addInconsistency(faceType* face1, faceType* face2,
+		       std::vector<std::pair<faceType*,faceType*> >& orient_inconsist)
+    //=======================================================================
+    {
+      size_t kr;
+      for (kr=0; kr<orient_inconsist.size(); ++kr)
+	if ((orient_inconsist[kr].first == face1 &&
+	     orient_inconsist[kr].second == face2) ||
+	    (orient_inconsist[kr].first == face2 &&
+	     orient_inconsist[kr].second == face1))
+	  break;
+
+      if (kr == orient_inconsist.size())
+	orient_inconsist.push_back(std::make_pair(face1, face2));
+    }
+
+    //=======================================================================
+    /// Match the edges of two faces with overlapping boxes, connecting
+    /// twins and splitting edges where necessary. Returns true if an
+    /// inconsistency in face orientation is found
+    bool matchFaces(const std::vector<shared_ptr<faceType> >& faces,
+		    int i, int j)
+    //=======================================================================
+    {
+      int k, l;
+      bool inconsistent = false;
+      std::vector<shared_ptr<edgeType> > startedges0, startedges1;
+      startedges0 = faces[i]->startEdges();
+      startedges1 = faces[j]->startEdges();
+      // Testing all loops in one surface against
+      // all loops in the other.
+      for (k = 0; k < int(startedges0.size()); ++k) {
+	for (l = 0; l < int(startedges1.size()); ++l) {
+	  edgeType* s0 = startedges0[k].get();
+	  edgeType* s1 = startedges1[l].get();
+	  if (s0 ==0 || s1 == 0) break;
+	  edgeType* e[2];
+	  e[0] = s0;
+	  e[1] = s1;
+	  edgeType* en[2];
+	  bool finished = false;
+	  while(!finished) {
+	    en[0] = e[0]->next();
+	    en[1] = e[1]->next();
+	    if (e[0]->twin() && e[0]->twin() == e[1] &&
+		e[1]->twin() && e[1]->twin() == e[0])
+	      {
+		// Already tested in the context of edge split
+		;
+	      }
+	    else if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
+					     tol_.neighbour)) {
+#ifdef DEBUG
+	    std::ofstream debug("top_debug.g2");
+	    for (int ki = 0; ki < 2; ++ki) {
+	      e[ki]->face()->surface()->writeStandardHeader(debug);
+	      e[ki]->face()->surface()->write(debug);
+	      std::vector<double> pts(12);
+	      Point from = e[ki]->point(e[ki]->tMin());
+	      double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
+	      Point mid = e[ki]->point(tmid);
+	      Point to = e[ki]->point(e[ki]->tMax());
+	      std::copy(from.begin(), from.end(), pts.begin());
+	      std::copy(mid.begin(), mid.end(), pts.begin() + 3);
+	      std::copy(mid.begin(), mid.end(), pts.begin() + 6);
+	      std::copy(to.begin(), to.end(), pts.begin() + 9);
+	      LineCloud lc(pts.begin(), 2);
+	      lc.writeStandardHeader(debug);
+	      lc.write(debug);
+	    }
+#endif
+	      // We found an edge overlap. Possible incident.
+	      int incident_occurred = 
+		testEdges(e);
+	      if (incident_occurred) {
+		// We skip the rest of this subloop (looping
+		// over edges e[1] in face faces[j]) by
+		// making en[1] so that e[0] will be
+		// incremented.
+		// If e[0] was split w/t-value higher than
+		// start value, do not forget first part of
+		// edge.
+
+		if (incident_occurred >= 2)
+		  {
+		    // Inconsistence in face orientation
+		    inconsistent = true;
+		  }
+	      }
+	    }
+
+	    // 17102017. Adjacency analysis functions with an incremental addition
+	    // of faces have a special security net for sliver faces. This may
+	    // need to be included here. 
+
+	    // Just to be sure in case the edge loop has changed
+	    startedges0 = faces[i]->startEdges();
+	    startedges1 = faces[j]->startEdges();
+	    edgeType* s0 = startedges0[k].get();
+	    edgeType* s1 = startedges1[l].get();
+	    if (s0 ==0 || s1 == 0) 
+	      break;
+	    // Pick next edges, check if we're done
+	    //e[1] = en[1];
+	    e[1] = e[1]->next();
+	    if (e[1] == s1) {
+	      //e[0] = en[0];
+	      e[0] = e[0]->next();
+	      if (e[0] == s0)
+		finished = true;
+	    }
+	  }
+	}
+      }
+      return inconsistent;
+    }
 
     //=======================================================================
     int testEdges(edgeType* e[2])
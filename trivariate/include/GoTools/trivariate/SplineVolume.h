@@ -46,6 +46,7 @@
 #include "GoTools/geometry/SplineSurface.h"
 #include "GoTools/geometry/RectDomain.h"
 #include "GoTools/utils/ScratchVect.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 
 
 namespace Go
@@ -372,6 +373,24 @@ public:
 		       bool w_from_right = true,
 		       double resolution = 1.0e-12) const;
 
+    /// Reentrant version of point(Point&, double, double, double). All
+    /// evaluation state is kept in 'ctx', so the volume may be evaluated
+    /// concurrently from several threads, each with its own context.
+    void point(Point& pt, double upar, double vpar, double wpar,
+	       SplineEvalContext& ctx) const;
+
+    /// Reentrant version of point(std::vector<Point>&, double, double,
+    /// double, int, bool, bool, bool, double), see
+    /// point(Point&, double, double, double, SplineEvalContext&).
+    void point(std::vector<Point>& pts, 
+	       double upar, double vpar, double wpar,
+	       int derivs,
+	       SplineEvalContext& ctx,
+	       bool u_from_right = true,
+	       bool v_from_right = true,
+	       bool w_from_right = true,
+	       double resolution = 1.0e-12) const;
+
     /// Get the start value for the specified parameter direction.
     /// \param i the parameter direction
     /// \return the start value for the parameter direction given by the parameter pardir
@@ -432,6 +451,18 @@ public:
 			      double         epsilon,
 			      double   *seed = 0) const;
 
+    /// Reentrant version of closestPoint(), see
+    /// point(Point&, double, double, double, SplineEvalContext&).
+    void closestPoint(const Point& pt,
+		      double&        clo_u,
+		      double&        clo_v, 
+		      double&        clo_w, 
+		      Point&         clo_pt,
+		      double&        clo_dist,
+		      double         epsilon,
+		      SplineEvalContext& ctx,
+		      double   *seed = 0) const;
+
     /// Returns the corner closest to a given point together with
     /// the associated enumeration of the corner coefficient.
     /// In degenerate cases, the enumeration will reflect an arbitrary 
@@ -1115,6 +1146,29 @@ private:
     void raiseOrder_wdir(int raise);
 
     double getSeed(const Point& pt, double par[]) const;
+
+    void closest_point_impl(const Point& pt,
+			    double& clo_u,
+			    double& clo_v, 
+			    double& clo_w, 
+			    Point& clo_pt,
+			    double& clo_dist,
+			    double epsilon,
+			    double *seed,
+			    SplineEvalContext* ctx) const;
+
+    // Tensor product evaluation from precomputed basis values. Shared by
+    // the ordinary and the reentrant point evaluators.
+    void pointFromBasis(Point& pt,
+			const double* basis_u, int uleft,
+			const double* basis_v, int vleft,
+			const double* basis_w, int wleft,
+			double* tmp_pt, double* tmp_pt2,
+			double* tmp_result) const;
+    void pointFromBasis(std::vector<Point>& pts, int derivs,
+			const double* basis_u, int uleft,
+			const double* basis_v, int vleft,
+			const double* basis_w, int wleft) const;
 			 
 
 };
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPLINEVOLUMELOCATOR_H
+#define _SPLINEVOLUMELOCATOR_H
+
+#include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/utils/BoxHierarchy.h"
+#include <vector>
+
+namespace Go
+{
+
+/// Maps points in physical space to the parameter domain of a SplineVolume.
+/// The locator is built once per volume and can then be queried from
+/// several threads. It keeps a bounding volume hierarchy over the Bezier
+/// elements of the volume, i.e. the knot span boxes, and the periodicity
+/// of the volume in each parameter direction. A point is located by Newton
+/// iteration started in the elements whose bounding boxes contain it. Points
+/// outside the volume are projected onto it, starting in the nearest
+/// elements. Only 3D volumes are supported.
+class GO_API SplineVolumeLocator
+{
+public:
+    /// Constructor. The volume must not be modified while the locator is
+    /// in use.
+    /// \param vol the volume
+    /// \param epsilon geometric tolerance. A point closer to the volume
+    ///                than this is reported as inside
+    SplineVolumeLocator(shared_ptr<SplineVolume> vol,
+			double epsilon = 1.0e-8);
+
+    /// Destructor
+    ~SplineVolumeLocator();
+
+    /// Map one point to the parameter domain of the volume.
+    /// \param pt the point
+    /// \param par the parameter of the closest point found in the volume
+    /// \param dist distance between pt and the volume in par
+    /// \param ctx evaluation context, one per thread
+    /// \return true if the point is inside the volume, i.e. dist <= epsilon
+    bool inverseMap(const Point& pt, double par[3], double& dist,
+		    SplineEvalContext& ctx) const;
+
+    /// Map a set of points in parallel (when compiled with OpenMP).
+    /// \param num_pts number of points
+    /// \param points point coordinates, 3 values per point
+    /// \param par output parameters, 3 values per point
+    /// \param dist output distance between each point and the volume
+    /// \param inside output, 1 for points inside the volume, 0 otherwise
+    void inverseMap(int num_pts, const double* points, double* par,
+		    double* dist, int* inside) const;
+
+    /// Map a set of points, see the array version of inverseMap().
+    void inverseMap(const std::vector<double>& points,
+		    std::vector<double>& par, std::vector<double>& dist,
+		    std::vector<int>& inside) const;
+
+    /// The volume
+    shared_ptr<SplineVolume> volume() const
+    {
+	return vol_;
+    }
+
+    /// Number of Bezier elements in the volume
+    int numElements() const
+    {
+	return hierarchy_.nmbBoxes();
+    }
+
+    /// Indices of the elements with bounding boxes containing the
+    /// point, extended by epsilon.
+    void containingElements(const Point& pt, std::vector<int>& elements) const;
+
+    /// The parameter domain of element number elem, stored as (umin, umax,
+    /// vmin, vmax, wmin, wmax)
+    void elementDomain(int elem, double domain[6]) const;
+
+    /// The memory used by the element boxes and the hierarchy, in bytes
+    size_t memory() const;
+
+private:
+    shared_ptr<SplineVolume> vol_;
+    double epsilon_;
+    double minpar_[3];
+    double maxpar_[3];
+    bool closed_[3];
+
+    /// Distinct knot values limiting the elements in each direction
+    std::vector<double> knots_[3];
+    /// Hierarchy over the element boxes. Element (iu, iv, iw) has
+    /// number (iw*nv + iv)*nu + iu, where nu and nv are the number of
+    /// elements in the first two directions
+    BoxHierarchy hierarchy_;
+
+    /// Compute the element boxes, 6 values (low, high) per element
+    void buildElementBoxes(std::vector<double>& elem_box);
+
+    /// Index of the element in each parameter direction
+    void elementPosition(int elem, int pos[3]) const;
+
+    /// Projected Newton iteration from par. Returns the distance
+    double iterate(const Point& pt, double par[3], SplineEvalContext& ctx,
+		   std::vector<Point>& der) const;
+};
+
+} // namespace Go
+
+#endif // _SPLINEVOLUMELOCATOR_H
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+
+#ifndef _INTRESULTSVOLMODEL_H
+#define _INTRESULTSVOLMODEL_H
+
+#include "GoTools/compositemodel/IntResultsModel.h"
+#include "GoTools/compositemodel/IntResultsSfModel.h"
+#include <vector>
+
+
+namespace Go
+{
+
+//===========================================================================
+/** Storage of results from intersection operations related to a VolumeModel.
+    The model is intersected through its boundary shells, and the results
+    are kept for each shell, each owned by the shell it was computed from.
+*/
+//
+//===========================================================================
+
+class IntResultsVolModel : public IntResultsModel
+{
+ public:
+
+  /// Constructor
+  IntResultsVolModel(const ftLine& line);
+
+  /// Constructor
+  IntResultsVolModel(const ftPlane& plane);
+
+  /// Destructor
+  ~IntResultsVolModel();
+
+  /// Add the intersection results of one boundary shell
+  /// \param body index of the connected set of volumes
+  /// \param shell index of the shell among the boundary shells of this set,
+  /// 0 is the outer boundary
+  /// \param results the intersections with this shell
+  void addShellResults(int body, int shell,
+		       shared_ptr<IntResultsSfModel> results);
+
+  /// Number of boundary shells with results
+  int nmbShells() const
+  {
+    return (int)shell_results_.size();
+  }
+
+  /// The results of one boundary shell
+  shared_ptr<IntResultsSfModel> getShellResults(int idx) const
+  {
+    return shell_results_[idx];
+  }
+
+  /// The connected set of volumes and the boundary shell of a result,
+  /// see addShellResults()
+  void getShellIndex(int idx, int& body, int& shell) const
+  {
+    body = shell_idx_[idx].first;
+    shell = shell_idx_[idx].second;
+  }
+
+  /// Check if any intersection curves are found
+  virtual bool hasIntCurves() const;
+
+  /// Return the number of intersection curve segments
+  virtual int nmbCurveSegments() const;
+
+  /// Check if any intersection points are found
+  virtual bool hasIntPoints() const;
+
+  /// Return the number of intersection points
+  virtual int nmbIntPoints() const;
+
+  /// Check if any intersections are found
+  virtual bool hasIntersections() const;
+
+  /// Tesselation
+  /// Tesselate with respect to a default value
+  virtual void tesselate(std::vector<shared_ptr<LineStrip> >& meshes,
+			 PointCloud3D& points) const;
+
+  /// Tesselate with respect to a given resolution, the same for each
+  /// intersection curve
+  virtual void tesselate(int resolution,
+			 std::vector<shared_ptr<LineStrip> >& meshes,
+			 PointCloud3D& points) const;
+
+  /// Tesselate with respect to a given density
+  virtual void tesselate(double density,
+			 std::vector<shared_ptr<LineStrip> >& meshes,
+			 PointCloud3D& points) const;
+
+ private:
+  std::vector<shared_ptr<IntResultsSfModel> > shell_results_;
+  std::vector<std::pair<int, int> > shell_idx_;
+
+  // Tesselate every shell with the given function and collect the results
+  template <class Tesselator>
+  void collect(Tesselator tesselator,
+	       std::vector<shared_ptr<LineStrip> >& meshes,
+	       PointCloud3D& points) const;
+};
+
+} // namespace Go
+
+
+
+#endif // _INTRESULTSVOLMODEL_H
@@ -48,6 +48,7 @@ namespace Go
 {
   class IntResultsModel;
   class GeneralMesh;
+  class VolumeModelLocator;
 
   /// \brief A set of volumes including topology information.
 
@@ -111,22 +112,54 @@ namespace Go
 			int nder,     // Number of derivatives to compute, 0=only position
 			std::vector<Point>& der) const;  // Result
 
-  /// Compute one closest point, interface heritage, not implemented
+  /// Compute one closest point. If the point lies inside the model, the
+  /// closest point is the point itself and idx is the body containing it.
+  /// See locatePoint()
   virtual void
     closestPoint(Point& pnt,     // Input point
 		 Point& clo_pnt, // Found closest point
-		 int& idx,           // Index of surface where the closest point is found
+		 int& idx,           // Index of volume where the closest point is found
 		 double clo_par[],   // Parameter value corrsponding to the closest point
 		 double& dist);  // Distance between input point and found closest point
 
-  /// Intersection with a line, interface heritage, not implemented. 
-  /// Expected output is points, probably one point. Curves 
-  /// can occur in special configurations. 
+  /// Intersection with the boundary shells of the model. 
+  /// Expected output is points where the line enters or leaves
+  /// the model. Curves can occur in special configurations. 
+  /// The result is an IntResultsVolModel with the results of each shell.
      virtual shared_ptr<IntResultsModel> intersect(const ftLine& line);
 
-  /// Intersection with a plane, interface heritage, not implemented. 
+  /// Intersection between a plane and the boundary shells of the model.
+  /// The result is an IntResultsVolModel with the results of each shell.
      virtual shared_ptr<IntResultsModel> intersect_plane(const ftPlane& plane);
 
+  /// Find the body containing a point and the parameter value of the
+  /// point in this body. If the point lies outside the model, the
+  /// closest point in the model is returned. The query uses a spatial
+  /// index over the bodies which is built at the first call and kept
+  /// until the model is modified through its own interface. Bodies
+  /// modified directly must be followed by a call to resetLocator().
+  /// \param pnt the point
+  /// \param par parameter value of the closest point in the found body
+  /// \param dist distance between pnt and the closest point. The point
+  ///             is inside the model if dist is within the gap tolerance
+  /// \return index of the body where the closest point is found, -1 if
+  ///         the model is empty
+  int locatePoint(const Point& pnt, double par[], double& dist) const;
+
+  /// Locate a set of points in parallel (when compiled with OpenMP), see
+  /// locatePoint().
+  /// \param points point coordinates, 3 values per point
+  /// \param body_idx output body index for each point
+  /// \param par output parameter values, 3 values per point
+  /// \param dist output distance between each point and the model
+  void locatePoints(const std::vector<double>& points,
+		    std::vector<int>& body_idx, std::vector<double>& par,
+		    std::vector<double>& dist) const;
+
+  /// Discard the spatial index used in point location. It is rebuilt
+  /// at the next query
+  void resetLocator();
+
   // Extremal point(s) in a given direction, interface heritage, not implemented
   virtual void
     extremalPoint(Point& dir,     // Direction
@@ -281,6 +314,9 @@ namespace Go
 
   double approxtol_;
 
+  /// Spatial index over the bodies, see locatePoint(). Built on demand
+  mutable shared_ptr<VolumeModelLocator> locator_;
+
   /// Local storage of intersection results. Used internally in VolumeModel.
   typedef struct intersection_point 
   {
@@ -311,6 +347,9 @@ namespace Go
       getIntSfModelsCrv(std::vector<shared_ptr<SurfaceModel> >& models, 
 			shared_ptr<SplineCurve> crv) const;
 
+    /// Fetch the spatial index over the bodies, build it if necessary
+    const VolumeModelLocator& locator() const;
+
     bool findBoundaryShell(shared_ptr<SurfaceModel> model,
 			   size_t& idx1, size_t& idx2) const;
 
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEMODELLOCATOR_H
+#define _VOLUMEMODELLOCATOR_H
+
+#include "GoTools/trivariatemodel/ftVolume.h"
+#include "GoTools/trivariate/SplineVolumeLocator.h"
+#include "GoTools/utils/BoxHierarchy.h"
+#include <vector>
+
+namespace Go
+{
+
+  /// \brief Point location in a set of volume bodies, typically the
+  /// blocks of a VolumeModel.
+  ///
+  /// The locator keeps a bounding volume hierarchy over the bounding boxes
+  /// of the bodies. Bodies that are spline volumes trimmed only along
+  /// their own boundary get a SplineVolumeLocator. Other bodies are
+  /// handled by ftVolume::closestPoint(). A point is located by visiting
+  /// the bodies nearest box first until one of them contains the point or
+  /// the remaining boxes are farther away than the closest point found.
+  /// The bodies must not be modified while the locator is in use.
+
+  class VolumeModelLocator
+  {
+  public:
+    /// Constructor
+    /// \param bodies the bodies
+    /// \param epsilon geometric tolerance. A point closer to a body than
+    ///                this is reported as inside the body
+    VolumeModelLocator(const std::vector<shared_ptr<ftVolume> >& bodies,
+		       double epsilon);
+
+    /// Destructor
+    ~VolumeModelLocator();
+
+    /// Number of bodies
+    int nmbBodies() const
+    {
+      return (int)bodies_.size();
+    }
+
+    /// Locate one point
+    /// \param pt the point
+    /// \param par parameter of the closest point found, in the volume of
+    ///            the returned body
+    /// \param dist distance between pt and the closest point found
+    /// \param ctx evaluation context, one per thread
+    /// \return index of the body where the closest point is found, -1 if
+    ///         there are no bodies. The point is inside this body if
+    ///         dist <= epsilon
+    int locate(const Point& pt, double par[3], double& dist,
+	       SplineEvalContext& ctx) const;
+
+    /// Locate a set of points in parallel (when compiled with OpenMP).
+    /// The points are located sequentially if any body lacks a
+    /// SplineVolumeLocator, see hasSplineLocator().
+    /// \param num_pts number of points
+    /// \param points point coordinates, 3 values per point
+    /// \param body output body index for each point, see locate()
+    /// \param par output parameters, 3 values per point
+    /// \param dist output distance between each point and the model
+    void locate(int num_pts, const double* points, int* body,
+		double* par, double* dist) const;
+
+    /// Locate a set of points, see the array version of locate()
+    void locate(const std::vector<double>& points, std::vector<int>& body,
+		std::vector<double>& par, std::vector<double>& dist) const;
+
+    /// Indices of the bodies with bounding boxes containing the point,
+    /// extended by epsilon.
+    void candidateBodies(const Point& pt, std::vector<int>& bodies) const;
+
+    /// Whether body number idx is located with a SplineVolumeLocator
+    bool hasSplineLocator(int idx) const
+    {
+      return (vol_loc_[idx].get() != 0);
+    }
+
+  private:
+    std::vector<shared_ptr<ftVolume> > bodies_;
+    double epsilon_;
+
+    /// One entry for each body, empty if the body is trimmed or not
+    /// a spline volume
+    std::vector<shared_ptr<SplineVolumeLocator> > vol_loc_;
+    /// Hierarchy over the bounding boxes of the bodies
+    BoxHierarchy hierarchy_;
+
+    /// Closest point in one body. Returns the distance
+    double locateInBody(int idx, const Point& pt, double par[3],
+			SplineEvalContext& ctx) const;
+  };
+
+} // namespace Go
+
+
+#endif // _VOLUMEMODELLOCATOR_H